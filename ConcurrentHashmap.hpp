@@ -0,0 +1,858 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUIERIKSSON_CONCURRENTHASHMAP_HPP
+#define LOUIERIKSSON_CONCURRENTHASHMAP_HPP
+
+#include "Epoch.hpp"
+#include "Hashmap.hpp"
+
+#include <array>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @class ConcurrentHashmap
+	 * @brief A lock-free Hashmap, implemented as a split-ordered list.
+	 * @details All entries live in a single lock-free linked list, sorted by the bit-reversal of their hashcodes.
+	 *          Buckets are shortcuts into the list, marked by sentinel nodes which are inserted lazily the first time a bucket is used.
+	 *          Doubling the number of buckets therefore never moves an entry: it is a single atomic increment, after which each new bucket
+	 *          splits its parent's range of the list as it is first visited. No operation ever blocks another.
+	 *
+	 *          Memory unlinked from the list is reclaimed via the process-wide EpochDomain, so values are returned by copy rather than by reference.
+	 *
+	 * @tparam Tk Key type of the ConcurrentHashmap.
+	 * @tparam Tv Value type of the ConcurrentHashmap.
+	 */
+	template<typename Tk, typename Tv>
+	class ConcurrentHashmap final {
+	
+	public:
+	
+		using KeyValuePair = typename Hashmap<Tk, Tv>::KeyValuePair;
+	
+	private:
+	
+		/** @brief A node of the split-ordered list. Sentinels mark the start of a bucket and carry no entry. */
+		struct Node final {
+			
+			/** @brief Bit-reversed hashcode. Odd for entries and even for sentinels, so that a bucket's sentinel precedes its entries. */
+			const size_t m_Order;
+			
+			/** @brief Hashcode of the entry, which orders entries whose split orders are equal. */
+			const size_t m_Hash;
+			
+			const std::optional<Tk> m_Key;
+			
+			/** @brief The current value. Replaced (never modified in place) when assigning. */
+			std::atomic<Tv*> m_Value;
+			
+			/** @brief Next node of the list. The lowest bit marks this node as logically removed. */
+			std::atomic<Node*> m_Next;
+			
+			/** @brief Initialise a sentinel. */
+			explicit Node(const size_t& _order) noexcept :
+				m_Order(_order),
+				m_Hash(0U),
+				m_Key(std::nullopt),
+				m_Value(nullptr),
+				m_Next(nullptr) {}
+			
+			/** @brief Initialise an entry. */
+			Node(const size_t& _order, const size_t& _hash, const Tk& _key, std::unique_ptr<Tv>&& _value) :
+				m_Order(_order),
+				m_Hash(_hash),
+				m_Key(_key),
+				m_Value(_value.release()),
+				m_Next(nullptr) {}
+			
+			Node(const Node&) = delete;
+			Node& operator =(const Node&) = delete;
+			
+			~Node() {
+				delete m_Value.load(std::memory_order_relaxed);
+			}
+		};
+		
+		/** @brief Result of searching the list. */
+		struct Position final {
+			
+			/** @brief Link referencing m_Current. */
+			std::atomic<Node*>* m_Previous;
+			
+			/** @brief First node not ordered before the target, or nullptr. */
+			Node* m_Current;
+			
+			/** @brief Whether m_Current is the target. */
+			bool m_Found;
+		};
+		
+		/** @brief Average number of entries per bucket above which the number of buckets doubles. */
+		static constexpr size_t s_LoadFactor = 2U;
+		
+		/** @brief Number of bits in a hashcode. */
+		static constexpr size_t s_Bits = sizeof(size_t) * CHAR_BIT;
+		
+		/**
+		 * @brief Segments of the bucket directory. Segment 0 holds bucket 0 and segment i > 0 holds buckets [2^(i-1), 2^i),
+		 *        so the directory can grow without ever moving an existing bucket.
+		 */
+		mutable std::array<std::atomic<std::atomic<Node*>*>, s_Bits + 1U> m_Segments;
+		
+		/** @brief Number of buckets in use. Always a power of two. */
+		std::atomic<size_t> m_BucketCount;
+		
+		/** @brief Number of entries. */
+		std::atomic<size_t> m_Size;
+		
+		/** @brief Sentinel of bucket 0, and head of the list. Readers may help unlink removed nodes, so the list is mutable. */
+		mutable Node m_Head;
+		
+		/**
+		 * @brief Get the hashcode of a given value.
+		 *
+		 * @param[in] _item The value to get the hashcode of.
+		 * @return The hashcode of the given value.
+		 * @throw std::exception If the type of _item is not supported by std::hash.
+		 */
+		static size_t GetHashcode(const Tk& _item) {
+			return std::hash<Tk>()(_item);
+		}
+		
+		/**
+		 * @brief Reverses the bits of a value.
+		 * @param[in] _value Value to reverse.
+		 * @return _value with its bits in reverse order.
+		 */
+		static constexpr size_t Reverse(size_t _value) noexcept {
+			
+			size_t result = 0U;
+			
+			for (size_t i = 0U; i < s_Bits; i += CHAR_BIT) {
+				result = (result << CHAR_BIT) | ReverseByte(static_cast<unsigned char>(_value >> i));
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Reverses the bits of a byte.
+		 * @param[in] _byte Byte to reverse.
+		 * @return _byte with its bits in reverse order.
+		 */
+		static constexpr size_t ReverseByte(unsigned char _byte) noexcept {
+			
+			size_t result = 0U;
+			
+			for (size_t i = 0U; i < CHAR_BIT; ++i) {
+				result = (result << 1U) | ((_byte >> i) & 1U);
+			}
+			
+			return result;
+		}
+		
+		/** @brief Split order of an entry with the given hashcode. */
+		static constexpr size_t EntryOrder(const size_t& _hash) noexcept { return Reverse(_hash) | 1U; }
+		
+		/** @brief Split order of the sentinel of the given bucket. */
+		static constexpr size_t SentinelOrder(const size_t& _bucket) noexcept { return Reverse(_bucket) & ~static_cast<size_t>(1U); }
+		
+		static Node* Marked  (Node* _node) noexcept { return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(_node) |  static_cast<std::uintptr_t>(1U)); }
+		static Node* Unmarked(Node* _node) noexcept { return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(_node) & ~static_cast<std::uintptr_t>(1U)); }
+		static bool  IsMarked(Node* _node) noexcept { return (reinterpret_cast<std::uintptr_t>(_node) & 1U) != 0U; }
+		
+		/**
+		 * @brief Returns the directory slot of a bucket, allocating its segment if necessary.
+		 *
+		 * @param[in] _bucket Index of the bucket.
+		 * @return The slot holding the bucket's sentinel, or nullptr if it is uninitialised.
+		 * @throw std::bad_alloc If the segment could not be allocated.
+		 */
+		std::atomic<Node*>& Slot(const size_t& _bucket) const {
+			
+			size_t segment = 0U;
+			size_t offset  = 0U;
+			
+			if (_bucket != 0U) {
+				
+				for (auto b = _bucket; b != 0U; b >>= 1U) {
+					++segment;
+				}
+				
+				offset = _bucket - (static_cast<size_t>(1U) << (segment - 1U));
+			}
+			
+			auto* slots = m_Segments[segment].load(std::memory_order_acquire);
+			
+			if (slots == nullptr) {
+				
+				const size_t length = segment == 0U ? 1U : (static_cast<size_t>(1U) << (segment - 1U));
+				
+				auto* allocated = new std::atomic<Node*>[length];
+				
+				for (size_t i = 0U; i < length; ++i) {
+					allocated[i].store(nullptr, std::memory_order_relaxed);
+				}
+				
+				if (m_Segments[segment].compare_exchange_strong(slots, allocated, std::memory_order_acq_rel)) {
+					slots = allocated;
+				}
+				else {
+					delete[] allocated;
+				}
+			}
+			
+			return slots[offset];
+		}
+		
+		/**
+		 * @brief Returns the sentinel of a bucket, inserting it (and those of its ancestors) if necessary.
+		 *
+		 * @param[in] _bucket Index of the bucket.
+		 * @return The sentinel of the bucket.
+		 * @throw std::bad_alloc If the sentinel could not be allocated.
+		 */
+		Node* Sentinel(const size_t& _bucket) const {
+			
+			auto& slot = Slot(_bucket);
+			
+			auto* sentinel = slot.load(std::memory_order_acquire);
+			
+			if (sentinel == nullptr) {
+				
+				// A bucket splits the range of its parent, which is the bucket with its highest set bit cleared.
+				size_t parent = _bucket;
+				for (size_t bit = static_cast<size_t>(1U) << (s_Bits - 1U); bit != 0U; bit >>= 1U) {
+					
+					if ((parent & bit) != 0U) {
+						parent &= ~bit;
+						break;
+					}
+				}
+				
+				auto created = std::make_unique<Node>(SentinelOrder(_bucket));
+				
+				sentinel = Insert(Sentinel(parent), created.get());
+				
+				if (sentinel == created.get()) {
+					created.release();
+				}
+				
+				slot.store(sentinel, std::memory_order_release);
+			}
+			
+			return sentinel;
+		}
+		
+		/**
+		 * @brief Searches the list for the node with the given order and hashcode, unlinking any logically removed nodes encountered.
+		 * @note The caller must pin an epoch.
+		 *
+		 * @param[in] _start Sentinel to begin the search from.
+		 * @param[in] _order Split order of the target.
+		 * @param[in] _hash Hashcode of the target.
+		 * @return The position of the target.
+		 */
+		Position Search(Node* _start, const size_t& _order, const size_t& _hash) const {
+			
+			for (;;) {
+				
+				auto* previous = &_start->m_Next;
+				auto* current  = previous->load(std::memory_order_acquire);
+				
+				for (;;) {
+					
+					if (current == nullptr) {
+						return { previous, nullptr, false };
+					}
+					
+					auto* next = current->m_Next.load(std::memory_order_acquire);
+					
+					if (previous->load(std::memory_order_acquire) != current) {
+						break;
+					}
+					
+					if (IsMarked(next)) {
+						
+						// Help complete the removal of the current node.
+						auto* expected = current;
+						
+						if (!previous->compare_exchange_strong(expected, Unmarked(next), std::memory_order_acq_rel)) {
+							break;
+						}
+						
+						EpochDomain::Global().Retire(current);
+						
+						current = Unmarked(next);
+					}
+					else if (current->m_Order > _order || (current->m_Order == _order && current->m_Hash >= _hash)) {
+						return { previous, current, current->m_Order == _order && current->m_Hash == _hash };
+					}
+					else {
+						previous = &current->m_Next;
+						current  = next;
+					}
+				}
+			}
+		}
+		
+		/**
+		 * @brief Links a node into the list unless a node of the same order already exists.
+		 * @note The caller must pin an epoch.
+		 *
+		 * @param[in] _start Sentinel to begin the search from.
+		 * @param[in] _node Node to insert.
+		 * @return _node if it was inserted, otherwise the existing node.
+		 */
+		Node* Insert(Node* _start, Node* _node) const {
+			
+			for (;;) {
+				
+				auto position = Search(_start, _node->m_Order, _node->m_Hash);
+				
+				if (position.m_Found) {
+					return position.m_Current;
+				}
+				
+				_node->m_Next.store(position.m_Current, std::memory_order_relaxed);
+				
+				if (position.m_Previous->compare_exchange_strong(position.m_Current, _node, std::memory_order_acq_rel)) {
+					return _node;
+				}
+			}
+		}
+		
+		/**
+		 * @brief Returns the sentinel of the bucket responsible for the given hashcode.
+		 *
+		 * @param[in] _hash Hashcode of the key.
+		 * @return The sentinel to begin searching from.
+		 */
+		Node* BucketOf(const size_t& _hash) const {
+			
+			// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
+			return Sentinel(_hash & (m_BucketCount.load(std::memory_order_acquire) - 1U));
+		}
+		
+		/**
+		 * @brief Finds the entry with the given hashcode.
+		 * @note The caller must pin an epoch.
+		 *
+		 * @param[in] _hash Hashcode of the key.
+		 * @return The entry, or nullptr if none exists.
+		 */
+		Node* FindNode(const size_t& _hash) const {
+			
+			const auto position = Search(BucketOf(_hash), EntryOrder(_hash), _hash);
+			
+			return position.m_Found ? position.m_Current : nullptr;
+		}
+		
+		/**
+		 * @brief Inserts or replaces the entry with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[in] _replace Whether to replace an existing entry.
+		 * @return True if an entry was inserted or replaced.
+		 * @throw std::exception If the key could not be hashed or memory could not be allocated.
+		 */
+		bool Store(const Tk& _key, const Tv& _value, const bool& _replace) {
+			
+			const auto hash = GetHashcode(_key);
+			
+			const auto guard = EpochDomain::Global().Pin();
+			
+			auto* start = BucketOf(hash);
+			
+			auto node = std::make_unique<Node>(EntryOrder(hash), hash, _key, std::make_unique<Tv>(_value));
+			
+			auto* result = Insert(start, node.get());
+			
+			if (result == node.get()) {
+				
+				node.release();
+				
+				Grow(m_Size.fetch_add(1U, std::memory_order_relaxed) + 1U);
+				
+				return true;
+			}
+			else if (_replace) {
+				
+				auto* previous = result->m_Value.exchange(node->m_Value.exchange(nullptr, std::memory_order_relaxed), std::memory_order_acq_rel);
+				
+				EpochDomain::Global().Retire(previous);
+				
+				return true;
+			}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Removes the entry with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @return True if this call removed the entry.
+		 * @throw std::exception If the key could not be hashed.
+		 */
+		bool Erase(const Tk& _key) {
+			
+			const auto hash = GetHashcode(_key);
+			
+			const auto guard = EpochDomain::Global().Pin();
+			
+			auto* start = BucketOf(hash);
+			
+			for (;;) {
+				
+				auto position = Search(start, EntryOrder(hash), hash);
+				
+				if (!position.m_Found) {
+					return false;
+				}
+				
+				auto* next = position.m_Current->m_Next.load(std::memory_order_acquire);
+				
+				if (IsMarked(next)) {
+					continue;
+				}
+				
+				// Logically remove the node by marking it, which prevents any further links to or from it.
+				if (position.m_Current->m_Next.compare_exchange_strong(next, Marked(next), std::memory_order_acq_rel)) {
+					
+					m_Size.fetch_sub(1U, std::memory_order_relaxed);
+					
+					// Physically unlink it, or leave that to the next search.
+					auto* expected = position.m_Current;
+					
+					if (position.m_Previous->compare_exchange_strong(expected, next, std::memory_order_acq_rel)) {
+						EpochDomain::Global().Retire(position.m_Current);
+					}
+					else {
+						Search(start, EntryOrder(hash), hash);
+					}
+					
+					return true;
+				}
+			}
+		}
+		
+		/**
+		 * @brief Doubles the number of buckets if the load factor has been exceeded.
+		 * @details Only the bucket count changes; new buckets are populated lazily.
+		 *
+		 * @param[in] _size Number of entries.
+		 */
+		void Grow(const size_t& _size) noexcept {
+			
+			auto count = m_BucketCount.load(std::memory_order_relaxed);
+			
+			if (_size > count * s_LoadFactor && count < (static_cast<size_t>(1U) << (s_Bits - 1U))) {
+				m_BucketCount.compare_exchange_strong(count, count * 2U, std::memory_order_acq_rel);
+			}
+		}
+		
+		/**
+		 * @brief Visits every entry while pinning an epoch.
+		 *
+		 * @param[in] _visitor Callable with the signature void(const Tk&, const Tv&).
+		 */
+		template<typename Tf>
+		void ForEach(Tf&& _visitor) const {
+			
+			const auto guard = EpochDomain::Global().Pin();
+			
+			for (auto* node = Unmarked(m_Head.m_Next.load(std::memory_order_acquire)); node != nullptr;) {
+				
+				auto* next = node->m_Next.load(std::memory_order_acquire);
+				
+				if (node->m_Key.has_value() && !IsMarked(next)) {
+					_visitor(*node->m_Key, *node->m_Value.load(std::memory_order_acquire));
+				}
+				
+				node = Unmarked(next);
+			}
+		}
+	
+	public:
+	
+		/**
+		 * @brief Initialise ConcurrentHashmap.
+		 * @param[in] _capacity Initial capacity of the ConcurrentHashmap.
+		 */
+		ConcurrentHashmap(const size_t& _capacity = 1U) :
+			m_BucketCount(1U),
+			m_Size(0U),
+			m_Head(0U)
+		{
+			for (auto& segment : m_Segments) {
+				segment.store(nullptr, std::memory_order_relaxed);
+			}
+			
+			Slot(0U).store(&m_Head, std::memory_order_relaxed);
+			
+			Reserve(_capacity);
+		}
+		
+		/**
+		 * @brief Initialise ConcurrentHashmap using a collection of key-value pairs.
+		 * @details Please note: The provided collection should be distinct. Otherwise, some data loss may occur as duplicate entries will be ignored.
+		 *
+		 * @param[in] _items A collection of key-value pairs.
+		 */
+		ConcurrentHashmap(const std::initializer_list<KeyValuePair>& _items) : ConcurrentHashmap(_items.size()) {
+			
+			for (const auto& item : _items) {
+				Assign(item.first, item.second);
+			}
+		}
+		
+		ConcurrentHashmap(const ConcurrentHashmap&) = delete;
+		ConcurrentHashmap& operator =(const ConcurrentHashmap&) = delete;
+		
+		/**
+		 * @brief Destroys the ConcurrentHashmap.
+		 * @details As with any container, no other thread may be accessing the ConcurrentHashmap during its destruction.
+		 */
+		~ConcurrentHashmap() {
+			
+			for (auto* node = Unmarked(m_Head.m_Next.load(std::memory_order_acquire)); node != nullptr;) {
+				
+				auto* next = Unmarked(node->m_Next.load(std::memory_order_relaxed));
+				
+				delete node;
+				
+				node = next;
+			}
+			
+			for (auto& segment : m_Segments) {
+				delete[] segment.load(std::memory_order_relaxed);
+			}
+		}
+		
+		/**
+		 * @brief Returns the number of items stored within the ConcurrentHashmap.
+		 * @return The number of items stored within the ConcurrentHashmap.
+		 */
+		[[nodiscard]] size_t size() const noexcept {
+			return m_Size.load(std::memory_order_relaxed);
+		}
+		
+		/**
+		 * @brief Is the ConcurrentHashmap empty?
+		 * @return Returns true if the ConcurrentHashmap contains no entries.
+		 */
+		[[nodiscard]] bool empty() const noexcept {
+			return size() == 0U;
+		}
+		
+		/**
+		 * @brief Queries for the existence of an item in the ConcurrentHashmap.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @return True if successful, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key) const noexcept {
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				return FindNode(hash) != nullptr;
+			}
+			catch (...) {}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Queries for the existence of an item in the ConcurrentHashmap.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 * @return True if successful, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				return FindNode(hash) != nullptr;
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Retrieves a copy of the value associated with the given key.
+		 *
+		 * @param[in] _key The key of the value to retrieve.
+		 * @return An optional containing a copy of the value if the key exists.
+		 */
+		std::optional<Tv> Get(const Tk& _key) const noexcept {
+			
+			std::optional<Tv> result;
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				if (const auto* node = FindNode(hash)) {
+					result.emplace(*node->m_Value.load(std::memory_order_acquire));
+				}
+			}
+			catch (...) {}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Retrieves a copy of the value associated with the given key.
+		 *
+		 * @param[in] _key The key of the value to retrieve.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 * @return An optional containing a copy of the value if the key exists.
+		 */
+		std::optional<Tv> Get(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			std::optional<Tv> result;
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				if (const auto* node = FindNode(hash)) {
+					result.emplace(*node->m_Value.load(std::memory_order_acquire));
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Inserts a new entry into the ConcurrentHashmap with given key and value, if one does not already exist.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value) noexcept {
+			
+			try {
+				return Store(_key, _value, false);
+			}
+			catch (...) {}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Inserts a new entry into the ConcurrentHashmap with given key and value, if one does not already exist.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			try {
+				return Store(_key, _value, false);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Inserts or replaces an entry within the ConcurrentHashmap with the given key.
+		 * @details Readers observe either the old value or the new one in its entirety.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 */
+		void Assign(const Tk& _key, const Tv& _value) noexcept {
+			
+			try {
+				Store(_key, _value, true);
+			}
+			catch (...) {}
+		}
+		
+		/**
+		 * @brief Inserts or replaces an entry within the ConcurrentHashmap with the given key.
+		 * @details Readers observe either the old value or the new one in its entirety.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 */
+		void Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			try {
+				Store(_key, _value, true);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+		}
+		
+		/**
+		 * @brief Removes entry with the given key from the ConcurrentHashmap.
+		 *
+		 * @param[in] _key Key of the entry to be removed.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Remove(const Tk& _key) noexcept {
+			
+			try {
+				return Erase(_key);
+			}
+			catch (...) {}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Removes entry with the given key from the ConcurrentHashmap.
+		 *
+		 * @param[in] _key Key of the entry to be removed.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 * @return True if successful, false otherwise.
+		 */
+		bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+			
+			try {
+				return Erase(_key);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Reserves buckets for the container to hold a minimum of _newSize elements without exceeding its load factor.
+		 * @details Buckets are populated lazily, so this only raises the bucket count.
+		 *
+		 * @param[in] _newSize The minimum capacity to reserve for the container.
+		 */
+		void Reserve(const std::size_t& _newSize) noexcept {
+			
+			auto count = m_BucketCount.load(std::memory_order_relaxed);
+			
+			size_t target = count;
+			while (target * s_LoadFactor < _newSize && target < (static_cast<size_t>(1U) << (s_Bits - 1U))) {
+				target *= 2U;
+			}
+			
+			while (count < target && !m_BucketCount.compare_exchange_weak(count, target, std::memory_order_acq_rel));
+		}
+		
+		/**
+		 * @brief Removes every entry from the ConcurrentHashmap.
+		 * @details Entries are removed one at a time, so entries inserted concurrently may survive.
+		 */
+		void Clear() noexcept {
+			
+			try {
+				for (const auto& key : Keys()) {
+					Erase(key);
+				}
+			}
+			catch (...) {}
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all keys stored within the ConcurrentHashmap.
+		 * @return A shallow copy of all keys stored within the ConcurrentHashmap.
+		 */
+		[[nodiscard]] std::vector<Tk> Keys() const {
+			
+			std::vector<Tk> result;
+			result.reserve(size());
+			
+			ForEach([&result](const Tk& _key, const Tv&) { result.emplace_back(_key); });
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all values stored within the ConcurrentHashmap.
+		 * @return A shallow copy of all values stored within the ConcurrentHashmap.
+		 */
+		[[nodiscard]] std::vector<Tv> Values() const {
+			
+			std::vector<Tv> result;
+			result.reserve(size());
+			
+			ForEach([&result](const Tk&, const Tv& _value) { result.emplace_back(_value); });
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all entries stored within the ConcurrentHashmap.
+		 * @return A shallow copy of all entries stored within the ConcurrentHashmap.
+		 */
+		[[nodiscard]] std::vector<KeyValuePair> GetAll() const {
+			
+			std::vector<KeyValuePair> result;
+			result.reserve(size());
+			
+			ForEach([&result](const Tk& _key, const Tv& _value) { result.emplace_back(_key, _value); });
+			
+			return result;
+		}
+	};
+
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_CONCURRENTHASHMAP_HPP
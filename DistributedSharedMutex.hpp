@@ -0,0 +1,209 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUIERIKSSON_DISTRIBUTEDSHAREDMUTEX_HPP
+#define LOUIERIKSSON_DISTRIBUTEDSHAREDMUTEX_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @class DistributedSharedMutex
+	 * @brief A reader-writer lock which counts readers across many cache lines, rather than one.
+	 * @details A std::shared_mutex counts its readers in a single word, so every reader on every core writes to the same cache line.
+	 *          Each thread is instead assigned one of several reader slots, each on its own cache line, so readers on different threads rarely contend.
+	 *          In exchange, a writer must wait for every slot to drain, making writes more expensive. Waiting writers take priority over new readers.
+	 *
+	 *          Satisfies the SharedMutex requirements, and may be used as the Mutex of a HashmapPolicy.
+	 *          A shared lock must be released by the thread which acquired it.
+	 *
+	 * @tparam Slots Number of reader slots.
+	 */
+	template<size_t Slots = 64U>
+	class DistributedSharedMutex final {
+		
+		static_assert(Slots > 0U, "The DistributedSharedMutex requires at least one reader slot.");
+		
+	private:
+		
+		/** @brief Number of readers holding the lock through a slot. Aligned to a cache line so that threads using different slots do not contend. */
+		struct alignas(64U) Slot final {
+			std::atomic<size_t> m_Readers { 0U };
+		};
+		
+		std::array<Slot, Slots> m_Slots;
+		
+		/** @brief Whether a writer holds, or is waiting for, the lock. */
+		alignas(64U) std::atomic<bool> m_Writer { false };
+		
+		/** @brief Serialises writers. */
+		std::mutex m_WriterLock;
+		
+		/**
+		 * @brief Returns the slot of the calling thread.
+		 * @details Threads are assigned slots in the order they first use any DistributedSharedMutex, spreading them evenly across the slots.
+		 *
+		 * @return The calling thread's slot.
+		 */
+		Slot& Local() noexcept {
+			
+			static std::atomic<size_t> s_Next { 0U };
+			
+			thread_local const size_t index = s_Next.fetch_add(1U, std::memory_order_relaxed);
+			
+			return m_Slots[index % Slots];
+		}
+		
+		/**
+		 * @brief Waits until every reader has released the lock. The caller must have announced itself as a writer.
+		 */
+		void Drain() noexcept {
+			
+			for (const auto& slot : m_Slots) {
+				
+				while (slot.m_Readers.load(std::memory_order_seq_cst) != 0U) {
+					std::this_thread::yield();
+				}
+			}
+		}
+		
+	public:
+		
+		DistributedSharedMutex() noexcept = default;
+		
+		DistributedSharedMutex(const DistributedSharedMutex&) = delete;
+		DistributedSharedMutex& operator =(const DistributedSharedMutex&) = delete;
+		
+		/**
+		 * @brief Acquires exclusive ownership of the lock, waiting for any readers to leave.
+		 */
+		void lock() {
+			
+			m_WriterLock.lock();
+			
+			m_Writer.store(true, std::memory_order_seq_cst);
+			
+			Drain();
+		}
+		
+		/**
+		 * @brief Attempts to acquire exclusive ownership of the lock without waiting.
+		 * @return True if the lock was acquired, false otherwise.
+		 */
+		bool try_lock() noexcept {
+			
+			bool result = m_WriterLock.try_lock();
+			
+			if (result) {
+				
+				m_Writer.store(true, std::memory_order_seq_cst);
+				
+				for (const auto& slot : m_Slots) {
+					
+					if (slot.m_Readers.load(std::memory_order_seq_cst) != 0U) {
+						result = false;
+						
+						break;
+					}
+				}
+				
+				if (!result) {
+					m_Writer.store(false, std::memory_order_release);
+					
+					m_WriterLock.unlock();
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Releases exclusive ownership of the lock.
+		 */
+		void unlock() noexcept {
+			
+			m_Writer.store(false, std::memory_order_release);
+			
+			m_WriterLock.unlock();
+		}
+		
+		/**
+		 * @brief Acquires shared ownership of the lock, waiting for any writer to leave.
+		 */
+		void lock_shared() noexcept {
+			
+			auto& slot = Local();
+			
+			for (;;) {
+				
+				// Announce the reader before checking for a writer. A writer announces itself before checking for readers, so at least one of the two backs off.
+				slot.m_Readers.fetch_add(1U, std::memory_order_seq_cst);
+				
+				if (!m_Writer.load(std::memory_order_seq_cst)) {
+					break;
+				}
+				
+				slot.m_Readers.fetch_sub(1U, std::memory_order_release);
+				
+				while (m_Writer.load(std::memory_order_acquire)) {
+					std::this_thread::yield();
+				}
+			}
+		}
+		
+		/**
+		 * @brief Attempts to acquire shared ownership of the lock without waiting.
+		 * @return True if the lock was acquired, false otherwise.
+		 */
+		bool try_lock_shared() noexcept {
+			
+			auto& slot = Local();
+			
+			slot.m_Readers.fetch_add(1U, std::memory_order_seq_cst);
+			
+			const bool result = !m_Writer.load(std::memory_order_seq_cst);
+			
+			if (!result) {
+				slot.m_Readers.fetch_sub(1U, std::memory_order_release);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Releases shared ownership of the lock.
+		 */
+		void unlock_shared() noexcept {
+			Local().m_Readers.fetch_sub(1U, std::memory_order_release);
+		}
+	};
+	
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_DISTRIBUTEDSHAREDMUTEX_HPP
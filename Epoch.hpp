@@ -0,0 +1,364 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUIERIKSSON_EPOCH_HPP
+#define LOUIERIKSSON_EPOCH_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @class EpochDomain
+	 * @brief Epoch-based reclamation of memory shared with lock-free readers.
+	 * @details Readers pin the current epoch for the duration of a read by holding a Guard, which only writes to a cache line owned by the reading thread.
+	 *          Writers unlink memory from their structure before retiring it, and retired memory is freed once the epoch has advanced twice,
+	 *          at which point no reader can still hold a reference to it.
+	 *
+	 *          A single process-wide domain is used, so that each thread needs only one record regardless of how many structures it reads.
+	 */
+	class EpochDomain final {
+	
+	private:
+	
+		/** @brief Per-thread announcement of the pinned epoch. Zero indicates that the thread is not reading. */
+		struct alignas(64U) Record final {
+			
+			std::atomic<size_t> m_Epoch { 0U };
+			std::atomic<bool>   m_InUse { true };
+			
+			Record* m_Next { nullptr };
+		};
+		
+		/** @brief Memory awaiting reclamation. */
+		struct Retired final {
+			
+			void* m_Pointer;
+			void (*m_Deleter)(void*);
+			
+			size_t m_Epoch;
+		};
+		
+		/** @brief Minimum number of objects retired by a thread which triggers an attempt at reclamation. */
+		static constexpr size_t s_CollectThreshold = 64U;
+		
+		/**
+		 * @brief Binds a Record to the calling thread, returning it to the domain when the thread exits.
+		 * @details Each thread queues the memory it retires separately, so that writers never contend to retire memory.
+		 */
+		struct ThreadState final {
+			
+			Record* m_Record { nullptr };
+			size_t  m_Depth  { 0U };
+			
+			std::vector<Retired> m_Retired;
+			
+			size_t m_Threshold { s_CollectThreshold };
+			
+			ThreadState() noexcept = default;
+			
+			ThreadState(const ThreadState&) = delete;
+			ThreadState& operator =(const ThreadState&) = delete;
+			
+			~ThreadState() {
+				
+				if (m_Record != nullptr) {
+					m_Record->m_Epoch.store(0U, std::memory_order_release);
+					m_Record->m_InUse.store(false, std::memory_order_release);
+				}
+				
+				if (!m_Retired.empty()) {
+					Global().Adopt(m_Retired);
+				}
+			}
+		};
+		
+		alignas(64U) std::atomic<size_t> m_Epoch { 1U };
+		
+		std::atomic<Record*> m_Records { nullptr };
+		
+		/** @brief Memory retired by threads which have since exited. */
+		std::mutex m_OrphansLock;
+		std::vector<Retired> m_Orphans;
+		
+		EpochDomain() noexcept = default;
+		
+		/**
+		 * @brief Returns the calling thread's record, acquiring one from the domain on first use.
+		 * @return The calling thread's state.
+		 */
+		ThreadState& Local() {
+			
+			thread_local ThreadState state;
+			
+			if (state.m_Record == nullptr) {
+				
+				// Reuse the record of a thread which has exited, if one exists.
+				for (auto* record = m_Records.load(std::memory_order_acquire); record != nullptr; record = record->m_Next) {
+					
+					bool expected = false;
+					
+					if (!record->m_InUse.load(std::memory_order_relaxed) &&
+					     record->m_InUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)
+					) {
+						state.m_Record = record;
+						break;
+					}
+				}
+				
+				if (state.m_Record == nullptr) {
+					
+					auto* record = new Record();
+					
+					record->m_Next = m_Records.load(std::memory_order_relaxed);
+					while (!m_Records.compare_exchange_weak(record->m_Next, record, std::memory_order_release, std::memory_order_relaxed));
+					
+					state.m_Record = record;
+				}
+			}
+			
+			return state;
+		}
+		
+		/**
+		 * @brief Advances the global epoch if every reading thread has observed the current one.
+		 *
+		 * @return The global epoch after the attempt.
+		 */
+		size_t TryAdvance() noexcept {
+			
+			const auto epoch = m_Epoch.load(std::memory_order_seq_cst);
+			
+			for (auto* record = m_Records.load(std::memory_order_acquire); record != nullptr; record = record->m_Next) {
+				
+				const auto pinned = record->m_Epoch.load(std::memory_order_seq_cst);
+				
+				if (pinned != 0U && pinned != epoch) {
+					return epoch;
+				}
+			}
+			
+			auto expected = epoch;
+			m_Epoch.compare_exchange_strong(expected, epoch + 1U, std::memory_order_seq_cst);
+			
+			return m_Epoch.load(std::memory_order_seq_cst);
+		}
+		
+		/**
+		 * @brief Frees the retired memory which can no longer be referenced by any reader.
+		 *
+		 * @param[in,out] _retired Retired memory.
+		 * @param[in] _epoch Current global epoch.
+		 */
+		static void Free(std::vector<Retired>& _retired, const size_t& _epoch) noexcept {
+			
+			const auto expired = std::partition(_retired.begin(), _retired.end(), [_epoch](const Retired& _item) {
+				return _item.m_Epoch + 2U > _epoch;
+			});
+			
+			for (auto itr = expired; itr != _retired.end(); ++itr) {
+				itr->m_Deleter(itr->m_Pointer);
+			}
+			
+			_retired.erase(expired, _retired.end());
+		}
+		
+		/**
+		 * @brief Frees the memory retired by the calling thread (and any orphaned memory) which can no longer be referenced by any reader.
+		 * @param[in,out] _state The calling thread's state.
+		 */
+		void Reclaim(ThreadState& _state) noexcept {
+			
+			const auto epoch = TryAdvance();
+			
+			Free(_state.m_Retired, epoch);
+			
+			// Back off while a reader holds the epoch back, keeping the cost of reclamation proportional to the memory retired.
+			_state.m_Threshold = std::max(s_CollectThreshold, _state.m_Retired.size() * 2U);
+			
+			const std::unique_lock<std::mutex> lock(m_OrphansLock, std::try_to_lock);
+			
+			if (lock.owns_lock()) {
+				Free(m_Orphans, epoch);
+			}
+		}
+		
+		/**
+		 * @brief Takes ownership of the memory retired by an exiting thread.
+		 * @param[in,out] _retired Retired memory.
+		 */
+		void Adopt(std::vector<Retired>& _retired) noexcept {
+			
+			try {
+				const std::lock_guard<std::mutex> lock(m_OrphansLock);
+				
+				m_Orphans.insert(m_Orphans.end(), _retired.begin(), _retired.end());
+			}
+			catch (...) {}
+			
+			_retired.clear();
+		}
+	
+	public:
+	
+		EpochDomain(const EpochDomain&) = delete;
+		EpochDomain& operator =(const EpochDomain&) = delete;
+		
+		/**
+		 * @brief Frees all outstanding retired memory.
+		 * @details The domain is only destroyed during static destruction, after which no reader may exist.
+		 */
+		~EpochDomain() {
+			
+			for (auto& retired : m_Orphans) {
+				retired.m_Deleter(retired.m_Pointer);
+			}
+			
+			for (auto* record = m_Records.load(std::memory_order_acquire); record != nullptr;) {
+				
+				auto* next = record->m_Next;
+				
+				delete record;
+				
+				record = next;
+			}
+		}
+		
+		/**
+		 * @brief Returns the process-wide EpochDomain.
+		 * @return The process-wide EpochDomain.
+		 */
+		static EpochDomain& Global() noexcept {
+			
+			static EpochDomain domain;
+			
+			return domain;
+		}
+		
+		/**
+		 * @class Guard
+		 * @brief Pins the current epoch for the lifetime of the guard, protecting any memory read within it from reclamation.
+		 * @details Guards may be nested. Memory read within a guard must not be used after the guard is destroyed.
+		 */
+		class Guard final {
+			
+			friend EpochDomain;
+		
+		private:
+		
+			ThreadState* m_State;
+			
+			explicit Guard(ThreadState& _state) noexcept : m_State(&_state) {}
+		
+		public:
+		
+			Guard(const Guard&) = delete;
+			Guard& operator =(const Guard&) = delete;
+			
+			Guard(Guard&& _other) noexcept : m_State(std::exchange(_other.m_State, nullptr)) {}
+			
+			Guard& operator =(Guard&&) = delete;
+			
+			~Guard() {
+				
+				if (m_State != nullptr && --m_State->m_Depth == 0U) {
+					m_State->m_Record->m_Epoch.store(0U, std::memory_order_release);
+				}
+			}
+		};
+		
+		/**
+		 * @brief Pins the current epoch on behalf of the calling thread.
+		 * @return A Guard which unpins the epoch when destroyed.
+		 * @throw std::bad_alloc If the calling thread's first record could not be allocated.
+		 */
+		[[nodiscard]] Guard Pin() {
+			
+			auto& state = Local();
+			
+			if (state.m_Depth++ == 0U) {
+				
+				auto& announced = state.m_Record->m_Epoch;
+				
+				// Re-announce until the announcement is visible before the epoch moves on,
+				// otherwise a writer could advance twice without having seen it.
+				auto epoch = m_Epoch.load(std::memory_order_seq_cst);
+				
+				for (;;) {
+					
+					announced.store(epoch, std::memory_order_seq_cst);
+					
+					const auto current = m_Epoch.load(std::memory_order_seq_cst);
+					
+					if (current == epoch) {
+						break;
+					}
+					
+					epoch = current;
+				}
+			}
+			
+			return Guard(state);
+		}
+		
+		/**
+		 * @brief Defers deletion of an object until no reader can hold a reference to it.
+		 * @details The object must already be unreachable for new readers.
+		 *
+		 * @tparam T Type of the object.
+		 * @param[in] _pointer Object to delete.
+		 * @throw std::bad_alloc If the object could not be queued, in which case it is leaked rather than freed prematurely.
+		 */
+		template<typename T>
+		void Retire(T* _pointer) {
+			
+			if (_pointer != nullptr) {
+				
+				auto& state = Local();
+				
+				state.m_Retired.push_back({ _pointer, [](void* _ptr) { delete static_cast<T*>(_ptr); }, m_Epoch.load(std::memory_order_seq_cst) });
+				
+				if (state.m_Retired.size() >= state.m_Threshold) {
+					Reclaim(state);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Attempts to free retired memory immediately.
+		 * @details Memory retired by the caller is not guaranteed to be freed, as readers on other threads may still be pinning an epoch.
+		 */
+		void Collect() {
+			Reclaim(Local());
+		}
+	};
+
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_EPOCH_HPP
@@ -0,0 +1,838 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUIERIKSSON_EPOCHHASHMAP_HPP
+#define LOUIERIKSSON_EPOCHHASHMAP_HPP
+
+#include "Epoch.hpp"
+#include "Hashmap.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @class EpochHashmap
+	 * @brief A Hashmap whose readers never lock, intended for read-mostly workloads.
+	 * @details Readers traverse the table while pinning an epoch of the process-wide EpochDomain, which writes only to a cache line owned by the reading thread.
+	 *          Writers are serialised by a mutex and never modify an entry which a reader may be observing. Instead, they publish replacement entries
+	 *          (or, when resizing, an entire replacement table) and retire the originals, which are freed once no reader can still reference them.
+	 *
+	 *          As entries may be reclaimed once a read completes, values are returned by copy rather than by reference.
+	 *
+	 *          Trivially-copyable values are instead overwritten in place under a sequence lock, sparing writers an allocation per assignment.
+	 *          Readers copy such values optimistically and retry only if a writer intervened (see TryGetCopy).
+	 *
+	 * @tparam Tk Key type of the EpochHashmap.
+	 * @tparam Tv Value type of the EpochHashmap.
+	 */
+	template<typename Tk, typename Tv>
+	class EpochHashmap final {
+	
+	public:
+	
+		using KeyValuePair = typename Hashmap<Tk, Tv>::KeyValuePair;
+	
+	private:
+	
+		/** @brief Whether values are overwritten in place under a sequence lock, rather than by publishing a replacement entry. */
+		static constexpr bool s_InPlace = std::is_trivially_copyable_v<Tv> && std::is_default_constructible_v<Tv>;
+		
+		/**
+		 * @brief A value which may be overwritten while being read, guarded by a version counter.
+		 * @details The version is odd while a write is in progress. Readers copy the value word by word and
+		 *          accept the copy only if the version was even and unchanged throughout.
+		 */
+		struct SeqlockValue final {
+			
+			static constexpr size_t s_Words = (sizeof(Tv) + sizeof(size_t) - 1U) / sizeof(size_t);
+			
+			std::atomic<size_t> m_Version;
+			
+			std::array<std::atomic<size_t>, s_Words> m_Words;
+			
+			explicit SeqlockValue(const Tv& _value) noexcept : m_Version(0U) {
+				Encode(_value);
+			}
+			
+			/**
+			 * @brief Copies the words of a value into the storage.
+			 * @param[in] _value Value to copy.
+			 */
+			void Encode(const Tv& _value) noexcept {
+				
+				std::array<size_t, s_Words> words {};
+				std::memcpy(words.data(), &_value, sizeof(Tv));
+				
+				for (size_t i = 0U; i < s_Words; ++i) {
+					m_Words[i].store(words[i], std::memory_order_relaxed);
+				}
+			}
+			
+			/**
+			 * @brief Copies the value without locking, retrying if a writer intervenes.
+			 * @param[out] _value Copy of the value.
+			 */
+			void Load(Tv& _value) const noexcept {
+				
+				std::array<size_t, s_Words> words;
+				
+				for (;;) {
+					
+					const auto before = m_Version.load(std::memory_order_acquire);
+					
+					if ((before & 1U) == 0U) {
+						
+						for (size_t i = 0U; i < s_Words; ++i) {
+							words[i] = m_Words[i].load(std::memory_order_relaxed);
+						}
+						
+						std::atomic_thread_fence(std::memory_order_acquire);
+						
+						if (m_Version.load(std::memory_order_relaxed) == before) {
+							break;
+						}
+					}
+				}
+				
+				std::memcpy(&_value, words.data(), sizeof(Tv));
+			}
+			
+			/**
+			 * @brief Overwrites the value. Writers must be serialised externally.
+			 * @param[in] _value New value.
+			 */
+			void Store(const Tv& _value) noexcept {
+				
+				const auto version = m_Version.load(std::memory_order_relaxed);
+				
+				m_Version.store(version + 1U, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+				
+				Encode(_value);
+				
+				m_Version.store(version + 2U, std::memory_order_release);
+			}
+		};
+		
+		/** @brief An entry of the EpochHashmap. Only the link to the next entry (and in-place values) may change after publication. */
+		struct Node final {
+			
+			const size_t m_Hash;
+			
+			const Tk m_Key;
+			
+			std::conditional_t<s_InPlace, SeqlockValue, const Tv> m_Value;
+			
+			std::atomic<Node*> m_Next;
+			
+			Node(const size_t& _hash, const Tk& _key, const Tv& _value, Node* _next) :
+				m_Hash(_hash),
+				m_Key(_key),
+				m_Value(_value),
+				m_Next(_next) {}
+			
+			/**
+			 * @brief Invokes a function on the value of the entry, or on a validated copy of it if it may be overwritten in place.
+			 * @param[in] _reader Callable with the signature void(const Tv&).
+			 */
+			template<typename Tf>
+			void Visit(Tf&& _reader) const {
+				
+				if constexpr (s_InPlace) {
+					
+					Tv value;
+					m_Value.Load(value);
+					
+					_reader(static_cast<const Tv&>(value));
+				}
+				else {
+					_reader(m_Value);
+				}
+			}
+		};
+		
+		/** @brief A bucket array. Destroying a table destroys every entry still reachable from it. */
+		struct Table final {
+			
+			const size_t m_Size;
+			
+			std::unique_ptr<std::atomic<Node*>[]> m_Buckets;
+			
+			explicit Table(const size_t& _size) :
+				m_Size(_size),
+				m_Buckets(new std::atomic<Node*>[_size])
+			{
+				for (size_t i = 0U; i < m_Size; ++i) {
+					m_Buckets[i].store(nullptr, std::memory_order_relaxed);
+				}
+			}
+			
+			Table(const Table&) = delete;
+			Table& operator =(const Table&) = delete;
+			
+			~Table() {
+				
+				for (size_t i = 0U; i < m_Size; ++i) {
+					
+					for (auto* node = m_Buckets[i].load(std::memory_order_relaxed); node != nullptr;) {
+						
+						auto* next = node->m_Next.load(std::memory_order_relaxed);
+						
+						delete node;
+						
+						node = next;
+					}
+				}
+			}
+			
+			/**
+			 * @brief Returns the bucket responsible for the given hash.
+			 * @param[in] _hash Hash of the key.
+			 * @return The bucket responsible for _hash.
+			 */
+			[[nodiscard]] std::atomic<Node*>& BucketOf(const size_t& _hash) const noexcept {
+				
+				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
+				return m_Buckets[_hash % m_Size];
+			}
+		};
+		
+		/** @brief The published table. Replaced (never modified in place) when resizing or clearing. */
+		std::atomic<Table*> m_Table;
+		
+		/** @brief Number of entries in the published table. */
+		std::atomic<size_t> m_Size;
+		
+		/** @brief Serialises writers. Readers never take it. */
+		mutable std::mutex m_WriteLock;
+		
+		/**
+		 * @brief Get the hashcode of a given value.
+		 *
+		 * @param[in] _item The value to get the hashcode of.
+		 * @return The hashcode of the given value.
+		 * @throw std::exception If the type of _item is not supported by std::hash.
+		 */
+		static size_t GetHashcode(const Tk& _item) {
+			return std::hash<Tk>()(_item);
+		}
+		
+		/**
+		 * @brief Finds the entry with the given hash in the published table.
+		 * @note The caller must either pin an epoch or hold m_WriteLock.
+		 *
+		 * @param[in] _hash Hash of the key.
+		 * @return The entry, or nullptr if none exists.
+		 */
+		const Node* FindNode(const size_t& _hash) const noexcept {
+			
+			const auto* table = m_Table.load(std::memory_order_acquire);
+			
+			for (const auto* node = table->BucketOf(_hash).load(std::memory_order_acquire); node != nullptr; node = node->m_Next.load(std::memory_order_acquire)) {
+				
+				if (node->m_Hash == _hash) {
+					return node;
+				}
+			}
+			
+			return nullptr;
+		}
+		
+		/**
+		 * @brief Finds the link referencing the entry with the given hash in the published table.
+		 * @note The caller must hold m_WriteLock.
+		 *
+		 * @param[in] _hash Hash of the key.
+		 * @return The link, or nullptr if no entry exists.
+		 */
+		std::atomic<Node*>* FindLink(const size_t& _hash) noexcept {
+			
+			for (auto* link = &m_Table.load(std::memory_order_relaxed)->BucketOf(_hash);;) {
+				
+				auto* node = link->load(std::memory_order_relaxed);
+				
+				if (node == nullptr) {
+					return nullptr;
+				}
+				else if (node->m_Hash == _hash) {
+					return link;
+				}
+				
+				link = &node->m_Next;
+			}
+		}
+		
+		/**
+		 * @brief Publishes a copy of the entries in a table of the given size and retires the current table.
+		 * @details Entries are copied rather than relinked, as relinking would divert readers still traversing the current table.
+		 * @note The caller must hold m_WriteLock.
+		 *
+		 * @param[in] _newSize Number of buckets of the new table.
+		 * @throw std::bad_alloc If the new table could not be allocated, in which case the current table is unchanged.
+		 */
+		void Rebuild(const size_t& _newSize) {
+			
+			const auto* current = m_Table.load(std::memory_order_relaxed);
+			
+			auto replacement = std::make_unique<Table>(std::max(_newSize, static_cast<size_t>(1U)));
+			
+			for (size_t i = 0U; i < current->m_Size; ++i) {
+				
+				for (const auto* node = current->m_Buckets[i].load(std::memory_order_relaxed); node != nullptr; node = node->m_Next.load(std::memory_order_relaxed)) {
+					
+					auto& bucket = replacement->BucketOf(node->m_Hash);
+					
+					node->Visit([node, &bucket](const Tv& _value) {
+						bucket.store(new Node(node->m_Hash, node->m_Key, _value, bucket.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+					});
+				}
+			}
+			
+			Publish(replacement.release());
+		}
+		
+		/**
+		 * @brief Publishes a replacement table and retires the current table along with its entries.
+		 * @note The caller must hold m_WriteLock.
+		 *
+		 * @param[in] _table Replacement table.
+		 */
+		void Publish(Table* _table) {
+			
+			auto* previous = m_Table.exchange(_table, std::memory_order_acq_rel);
+			
+			EpochDomain::Global().Retire(previous);
+		}
+		
+		/**
+		 * @brief Inserts or replaces the entry with the given key.
+		 * @note The caller must hold m_WriteLock.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[in] _replace Whether to replace an existing entry.
+		 * @return True if an entry was inserted or replaced.
+		 * @throw std::exception If the key could not be hashed or memory could not be allocated.
+		 */
+		bool Store(const Tk& _key, const Tv& _value, const bool& _replace) {
+			
+			const auto hash = GetHashcode(_key);
+			
+			if (auto* link = FindLink(hash)) {
+				
+				if (_replace) {
+					
+					auto* previous = link->load(std::memory_order_relaxed);
+					
+					if constexpr (s_InPlace) {
+						previous->m_Value.Store(_value);
+					}
+					else {
+						link->store(new Node(hash, _key, _value, previous->m_Next.load(std::memory_order_relaxed)), std::memory_order_release);
+					
+						EpochDomain::Global().Retire(previous);
+					}
+				}
+				
+				return _replace;
+			}
+			
+			if (m_Size.load(std::memory_order_relaxed) >= m_Table.load(std::memory_order_relaxed)->m_Size) {
+				Rebuild(m_Table.load(std::memory_order_relaxed)->m_Size * 2U);
+			}
+			
+			auto& bucket = m_Table.load(std::memory_order_relaxed)->BucketOf(hash);
+			
+			bucket.store(new Node(hash, _key, _value, bucket.load(std::memory_order_relaxed)), std::memory_order_release);
+			
+			m_Size.fetch_add(1U, std::memory_order_relaxed);
+			
+			return true;
+		}
+		
+		/**
+		 * @brief Unlinks and retires the entry with the given key.
+		 * @note The caller must hold m_WriteLock.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @return True if an entry was removed.
+		 * @throw std::exception If the key could not be hashed.
+		 */
+		bool Erase(const Tk& _key) {
+			
+			if (auto* link = FindLink(GetHashcode(_key))) {
+				
+				auto* previous = link->load(std::memory_order_relaxed);
+				
+				link->store(previous->m_Next.load(std::memory_order_relaxed), std::memory_order_release);
+				
+				m_Size.fetch_sub(1U, std::memory_order_relaxed);
+				
+				EpochDomain::Global().Retire(previous);
+				
+				return true;
+			}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Visits every entry of the published table while pinning an epoch.
+		 *
+		 * @param[in] _visitor Callable with the signature void(const Tk&, const Tv&).
+		 */
+		template<typename Tf>
+		void ForEach(Tf&& _visitor) const {
+			
+			const auto guard = EpochDomain::Global().Pin();
+			
+			const auto* table = m_Table.load(std::memory_order_acquire);
+			
+			for (size_t i = 0U; i < table->m_Size; ++i) {
+				
+				for (const auto* node = table->m_Buckets[i].load(std::memory_order_acquire); node != nullptr; node = node->m_Next.load(std::memory_order_acquire)) {
+					node->Visit([node, &_visitor](const Tv& _value) { _visitor(node->m_Key, _value); });
+				}
+			}
+		}
+	
+	public:
+	
+		/**
+		 * @brief Initialise EpochHashmap.
+		 * @param[in] _capacity Initial capacity of the EpochHashmap. Must be larger than 0.
+		 */
+		EpochHashmap(const size_t& _capacity = 1U) :
+			m_Table(new Table(std::max(_capacity, static_cast<size_t>(1U)))),
+			m_Size(0U) {}
+		
+		/**
+		 * @brief Initialise EpochHashmap using a collection of key-value pairs.
+		 * @details Please note: The provided collection should be distinct. Otherwise, some data loss may occur as duplicate entries will be ignored.
+		 *
+		 * @param[in] _items A collection of key-value pairs.
+		 */
+		EpochHashmap(const std::initializer_list<KeyValuePair>& _items) : EpochHashmap(_items.size()) {
+			
+			for (const auto& item : _items) {
+				Assign(item.first, item.second);
+			}
+		}
+		
+		EpochHashmap(const EpochHashmap&) = delete;
+		EpochHashmap& operator =(const EpochHashmap&) = delete;
+		
+		/**
+		 * @brief Destroys the EpochHashmap.
+		 * @details As with any container, no other thread may be accessing the EpochHashmap during its destruction.
+		 */
+		~EpochHashmap() {
+			delete m_Table.load(std::memory_order_acquire);
+		}
+		
+		/**
+		 * @brief Returns the number of items stored within the EpochHashmap.
+		 * @return The number of items stored within the EpochHashmap.
+		 */
+		[[nodiscard]] size_t size() const noexcept {
+			return m_Size.load(std::memory_order_relaxed);
+		}
+		
+		/**
+		 * @brief Is the EpochHashmap empty?
+		 * @return Returns true if the EpochHashmap contains no entries.
+		 */
+		[[nodiscard]] bool empty() const noexcept {
+			return size() == 0U;
+		}
+		
+		/**
+		 * @brief Queries for the existence of an item in the EpochHashmap without locking.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @return True if successful, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key) const noexcept {
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				return FindNode(hash) != nullptr;
+			}
+			catch (...) {}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Queries for the existence of an item in the EpochHashmap without locking.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 * @return True if successful, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				return FindNode(hash) != nullptr;
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Retrieves a copy of the value associated with the given key without locking.
+		 *
+		 * @param[in] _key The key of the value to retrieve.
+		 * @return An optional containing a copy of the value if the key exists.
+		 */
+		std::optional<Tv> Get(const Tk& _key) const noexcept {
+			
+			std::optional<Tv> result;
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				if (const auto* node = FindNode(hash)) {
+					node->Visit([&result](const Tv& _value) { result.emplace(_value); });
+				}
+			}
+			catch (...) {}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Retrieves a copy of the value associated with the given key without locking.
+		 *
+		 * @param[in] _key The key of the value to retrieve.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 * @return An optional containing a copy of the value if the key exists.
+		 */
+		std::optional<Tv> Get(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			std::optional<Tv> result;
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				if (const auto* node = FindNode(hash)) {
+					node->Visit([&result](const Tv& _value) { result.emplace(_value); });
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Invokes a function on the value associated with the given key without locking.
+		 * @details The value is not copied unless it is trivially copyable. It must not be referenced after the function returns.
+		 *
+		 * @param[in] _key The key of the value to read.
+		 * @param[in] _reader Callable with the signature void(const Tv&).
+		 * @return True if the key exists and the function was invoked, false otherwise.
+		 */
+		template<typename Tf>
+		bool Read(const Tk& _key, Tf&& _reader) const noexcept {
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				if (const auto* node = FindNode(hash)) {
+					node->Visit(std::forward<Tf>(_reader));
+					
+					return true;
+				}
+			}
+			catch (...) {}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Copies the value associated with the given key without locking, validating the copy against the entry's version counter.
+		 * @details Only available for trivially-copyable, default-constructible values, which writers overwrite in place.
+		 *          The copy is retried only if a writer modified the entry while it was being read.
+		 *
+		 * @param[in] _key The key of the value to retrieve.
+		 * @param[out] _value Copy of the value, if the key exists. Unchanged otherwise.
+		 * @return True if the key exists, false otherwise.
+		 */
+		bool TryGetCopy(const Tk& _key, Tv& _value) const noexcept {
+			
+			static_assert(s_InPlace, "TryGetCopy requires a trivially-copyable, default-constructible value type.");
+			
+			try {
+				const auto hash = GetHashcode(_key);
+				
+				const auto guard = EpochDomain::Global().Pin();
+				
+				if (const auto* node = FindNode(hash)) {
+					node->m_Value.Load(_value);
+					
+					return true;
+				}
+			}
+			catch (...) {}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Inserts a new entry into the EpochHashmap with given key and value, if one does not already exist.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value) noexcept {
+			
+			try {
+				const std::lock_guard<std::mutex> lock(m_WriteLock);
+				
+				return Store(_key, _value, false);
+			}
+			catch (...) {}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Inserts a new entry into the EpochHashmap with given key and value, if one does not already exist.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			try {
+				const std::lock_guard<std::mutex> lock(m_WriteLock);
+				
+				return Store(_key, _value, false);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Inserts or replaces an entry within the EpochHashmap with the given key.
+		 * @details Readers observe either the old value or the new one in its entirety.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 */
+		void Assign(const Tk& _key, const Tv& _value) noexcept {
+			
+			try {
+				const std::lock_guard<std::mutex> lock(m_WriteLock);
+				
+				Store(_key, _value, true);
+			}
+			catch (...) {}
+		}
+		
+		/**
+		 * @brief Inserts or replaces an entry within the EpochHashmap with the given key.
+		 * @details Readers observe either the old value or the new one in its entirety.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 */
+		void Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			try {
+				const std::lock_guard<std::mutex> lock(m_WriteLock);
+				
+				Store(_key, _value, true);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+		}
+		
+		/**
+		 * @brief Removes entry with the given key from the EpochHashmap.
+		 *
+		 * @param[in] _key Key of the entry to be removed.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Remove(const Tk& _key) noexcept {
+			
+			try {
+				const std::lock_guard<std::mutex> lock(m_WriteLock);
+				
+				return Erase(_key);
+			}
+			catch (...) {}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Removes entry with the given key from the EpochHashmap.
+		 *
+		 * @param[in] _key Key of the entry to be removed.
+		 * @param[out] _exception Exception thrown by the operation (if any).
+		 * @return True if successful, false otherwise.
+		 */
+		bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+			
+			try {
+				const std::lock_guard<std::mutex> lock(m_WriteLock);
+				
+				return Erase(_key);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return false;
+		}
+		
+		/**
+		 * @brief Reserves memory for the container to have a minimum capacity of _newSize elements.
+		 *
+		 * @param[in] _newSize The minimum capacity to reserve for the container.
+		 */
+		void Reserve(const std::size_t& _newSize) {
+			
+			const std::lock_guard<std::mutex> lock(m_WriteLock);
+			
+			if (m_Table.load(std::memory_order_relaxed)->m_Size < _newSize) {
+				Rebuild(_newSize);
+			}
+		}
+		
+		/**
+		 * @brief Trims unused buckets from the EpochHashmap.
+		 */
+		void Trim() {
+			
+			const std::lock_guard<std::mutex> lock(m_WriteLock);
+			
+			if (m_Size.load(std::memory_order_relaxed) < m_Table.load(std::memory_order_relaxed)->m_Size) {
+				Rebuild(m_Size.load(std::memory_order_relaxed));
+			}
+		}
+		
+		/**
+		 * @brief Clears all entries from the EpochHashmap.
+		 * @details Readers which began before the EpochHashmap was cleared may still observe its previous entries.
+		 */
+		void Clear() noexcept {
+			
+			try {
+				const std::lock_guard<std::mutex> lock(m_WriteLock);
+				
+				Publish(new Table(1U));
+				
+				m_Size.store(0U, std::memory_order_relaxed);
+			}
+			catch (...) {}
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all keys stored within the EpochHashmap.
+		 * @return A shallow copy of all keys stored within the EpochHashmap.
+		 */
+		[[nodiscard]] std::vector<Tk> Keys() const {
+			
+			std::vector<Tk> result;
+			result.reserve(size());
+			
+			ForEach([&result](const Tk& _key, const Tv&) { result.emplace_back(_key); });
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all values stored within the EpochHashmap.
+		 * @return A shallow copy of all values stored within the EpochHashmap.
+		 */
+		[[nodiscard]] std::vector<Tv> Values() const {
+			
+			std::vector<Tv> result;
+			result.reserve(size());
+			
+			ForEach([&result](const Tk&, const Tv& _value) { result.emplace_back(_value); });
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all entries stored within the EpochHashmap.
+		 * @return A shallow copy of all entries stored within the EpochHashmap.
+		 */
+		[[nodiscard]] std::vector<KeyValuePair> GetAll() const {
+			
+			std::vector<KeyValuePair> result;
+			result.reserve(size());
+			
+			ForEach([&result](const Tk& _key, const Tv& _value) { result.emplace_back(_key, _value); });
+			
+			return result;
+		}
+	};
+
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_EPOCHHASHMAP_HPP
@@ -0,0 +1,519 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef LOUIERIKSSON_FIXEDHASHMAP_HPP
+#define LOUIERIKSSON_FIXEDHASHMAP_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @brief A Hashmap with a fixed capacity, which stores its entries inline and never allocates.
+	 * @details Entries are stored in an open-addressed array of N slots, probed linearly, and removal shifts the following entries back rather than leaving tombstones.
+	 *          The map is guarded by a spinlock on a lock-free atomic, which contains no pointers, so a FixedHashmap may be placed on the stack,
+	 *          in static storage, or in memory shared between processes. As with Hashmap, keys are compared by hashcode.
+	 *          Memory allocated by the keys and values themselves (such as that of a std::string) is outside of the FixedHashmap's control.
+	 *
+	 * @tparam Tk Key type of the FixedHashmap.
+	 * @tparam Tv Value type of the FixedHashmap.
+	 * @tparam N Maximum number of entries.
+	 */
+	template<typename Tk, typename Tv, size_t N>
+	class FixedHashmap final {
+		
+		static_assert(N > 0U, "The FixedHashmap requires a capacity of at least one entry.");
+		static_assert(std::atomic<bool>::is_always_lock_free, "The FixedHashmap requires a lock-free std::atomic<bool>.");
+		
+	public:
+		
+		/** @brief Represents a key-value pair. */
+		struct KeyValuePair final {
+			
+			Tk first;
+			Tv second;
+		};
+		
+	private:
+		
+		/** @brief A slot of the FixedHashmap, holding at most one entry. */
+		struct Slot final {
+			
+			size_t m_Hash { 0U };
+			bool   m_Used { false };
+			
+			alignas(KeyValuePair) unsigned char m_Storage[sizeof(KeyValuePair)];
+			
+			KeyValuePair& Entry() noexcept {
+				return *std::launder(reinterpret_cast<KeyValuePair*>(m_Storage));
+			}
+			
+			const KeyValuePair& Entry() const noexcept {
+				return *std::launder(reinterpret_cast<const KeyValuePair*>(m_Storage));
+			}
+		};
+		
+		/** @brief Guards the slots. */
+		mutable std::atomic<bool> m_Lock { false };
+		
+		size_t m_Size { 0U };
+		
+		std::array<Slot, N> m_Slots {};
+		
+		/**
+		 * @brief Holds the lock of a FixedHashmap for the lifetime of the guard.
+		 * @details Spins briefly before yielding, as the lock is only ever held for the duration of a single operation.
+		 */
+		class Guard final {
+			
+			std::atomic<bool>& m_Lock;
+			
+		public:
+			
+			explicit Guard(std::atomic<bool>& _lock) noexcept : m_Lock(_lock) {
+				
+				for (size_t spins = 0U; m_Lock.exchange(true, std::memory_order_acquire); ++spins) {
+					
+					while (m_Lock.load(std::memory_order_relaxed)) {
+						
+						if (++spins > 64U) {
+							std::this_thread::yield();
+						}
+					}
+				}
+			}
+			
+			Guard(const Guard&) = delete;
+			Guard& operator =(const Guard&) = delete;
+			
+			~Guard() {
+				m_Lock.store(false, std::memory_order_release);
+			}
+		};
+		
+		/**
+		 * @brief Calculates the hashcode of a given key.
+		 * @param[in] _item Key to calculate the hash of.
+		 * @return Hashcode of _item.
+		 */
+		static constexpr size_t GetHashcode(const Tk& _item) {
+			return std::hash<Tk>()(_item);
+		}
+		
+		/**
+		 * @brief Finds the slot holding the entry with the given hashcode. The caller must hold the lock.
+		 * @param[in] _hash Hashcode of the key.
+		 * @return Index of the slot, or N if no entry exists.
+		 */
+		size_t Locate(const size_t& _hash) const noexcept {
+			
+			auto result = N;
+			
+			for (size_t i = 0U, slot = _hash % N; i < N && m_Slots[slot].m_Used; ++i, slot = (slot + 1U) % N) {
+				
+				if (m_Slots[slot].m_Hash == _hash) {
+					result = slot;
+					
+					break;
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Inserts or replaces the entry with the given key. The caller must hold the lock.
+		 * @details If an exception is thrown, the FixedHashmap is left unchanged.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[in] _replace Whether to replace the value of an existing entry.
+		 * @return True if an entry was inserted or replaced, false otherwise.
+		 */
+		bool Store(const Tk& _key, const Tv& _value, const bool& _replace) {
+			
+			auto result = false;
+			
+			const auto hash  = GetHashcode(_key);
+			const auto found = Locate(hash);
+			
+			if (found != N) {
+				
+				if (_replace) {
+					m_Slots[found].Entry().second = _value;
+					
+					result = true;
+				}
+			}
+			else if (m_Size < N) {
+				
+				auto slot = hash % N;
+				
+				while (m_Slots[slot].m_Used) {
+					slot = (slot + 1U) % N;
+				}
+				
+				::new (static_cast<void*>(m_Slots[slot].m_Storage)) KeyValuePair { _key, _value };
+				
+				m_Slots[slot].m_Hash = hash;
+				m_Slots[slot].m_Used = true;
+				
+				++m_Size;
+				
+				result = true;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Removes the entry in a slot, shifting back any following entries displaced from their home slot. The caller must hold the lock.
+		 * @param[in] _slot Index of the slot.
+		 */
+		void Erase(size_t _slot) noexcept {
+			
+			m_Slots[_slot].Entry().~KeyValuePair();
+			m_Slots[_slot].m_Used = false;
+			
+			for (auto next = (_slot + 1U) % N; m_Slots[next].m_Used; next = (next + 1U) % N) {
+				
+				const auto home = m_Slots[next].m_Hash % N;
+				
+				// An entry may only move back if its home slot does not lie cyclically within (_slot, next].
+				const auto stays = _slot <= next ?
+					(home > _slot && home <= next) :
+					(home > _slot || home <= next);
+				
+				if (!stays) {
+					
+					::new (static_cast<void*>(m_Slots[_slot].m_Storage)) KeyValuePair(std::move(m_Slots[next].Entry()));
+					
+					m_Slots[_slot].m_Hash = m_Slots[next].m_Hash;
+					m_Slots[_slot].m_Used = true;
+					
+					m_Slots[next].Entry().~KeyValuePair();
+					m_Slots[next].m_Used = false;
+					
+					_slot = next;
+				}
+			}
+			
+			--m_Size;
+		}
+		
+		/** @brief Destroys every entry. The caller must hold the lock. */
+		void Destroy() noexcept {
+			
+			for (auto& slot : m_Slots) {
+				
+				if (slot.m_Used) {
+					slot.Entry().~KeyValuePair();
+					slot.m_Used = false;
+				}
+			}
+			
+			m_Size = 0U;
+		}
+		
+	public:
+		
+		constexpr FixedHashmap() noexcept = default;
+		
+		/**
+		 * @brief Copy constructor.
+		 * @param[in] _other The FixedHashmap to copy from.
+		 */
+		FixedHashmap(const FixedHashmap& _other) {
+			
+			const Guard guard(_other.m_Lock);
+			
+			for (size_t i = 0U; i < N; ++i) {
+				
+				if (_other.m_Slots[i].m_Used) {
+					
+					::new (static_cast<void*>(m_Slots[i].m_Storage)) KeyValuePair(_other.m_Slots[i].Entry());
+					
+					m_Slots[i].m_Hash = _other.m_Slots[i].m_Hash;
+					m_Slots[i].m_Used = true;
+					
+					++m_Size;
+				}
+			}
+		}
+		
+		/**
+		 * @brief Copy assignment operator.
+		 * @details If an exception is thrown, the FixedHashmap is left empty.
+		 *
+		 * @param[in] _other The FixedHashmap to copy from.
+		 * @return A reference to the FixedHashmap.
+		 */
+		FixedHashmap& operator = (const FixedHashmap& _other) {
+			
+			if (this != &_other) {
+				
+				// Acquire the FixedHashmaps in a consistent order, so that concurrent assignments in opposite directions cannot deadlock.
+				const auto ordered = std::less<const FixedHashmap*>()(this, &_other);
+				
+				const Guard first (ordered ?   m_Lock : _other.m_Lock);
+				const Guard second(ordered ? _other.m_Lock :   m_Lock);
+				
+				Destroy();
+				
+				for (size_t i = 0U; i < N; ++i) {
+					
+					if (_other.m_Slots[i].m_Used) {
+						
+						::new (static_cast<void*>(m_Slots[i].m_Storage)) KeyValuePair(_other.m_Slots[i].Entry());
+						
+						m_Slots[i].m_Hash = _other.m_Slots[i].m_Hash;
+						m_Slots[i].m_Used = true;
+						
+						++m_Size;
+					}
+				}
+			}
+			
+			return *this;
+		}
+		
+		~FixedHashmap() {
+			Destroy();
+		}
+		
+		/** @brief Returns the number of entries in the FixedHashmap. */
+		[[nodiscard]] size_t size() const noexcept {
+			
+			const Guard guard(m_Lock);
+			
+			return m_Size;
+		}
+		
+		[[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+		
+		/** @brief Returns the maximum number of entries of the FixedHashmap. */
+		[[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+		
+		/**
+		 * @brief Determines whether the FixedHashmap contains the given key.
+		 *
+		 * @param[in] _key Key to check for.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if the key exists, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				const Guard guard(m_Lock);
+				
+				result = Locate(hash) != N;
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc ContainsKey(const Tk&, std::exception_ptr&) const */
+		bool ContainsKey(const Tk& _key) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return ContainsKey(_key, exception);
+		}
+		
+		/**
+		 * @brief Inserts a new entry with the given key and value, if one does not already exist and the FixedHashmap is not full.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const Guard guard(m_Lock);
+				
+				result = Store(_key, _value, false);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Add(const Tk&, const Tv&, std::exception_ptr&) */
+		bool Add(const Tk& _key, const Tv& _value) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Add(_key, _value, exception);
+		}
+		
+		/**
+		 * @brief Inserts or replaces the entry with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, or false if the key is new and the FixedHashmap is full.
+		 */
+		bool Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const Guard guard(m_Lock);
+				
+				result = Store(_key, _value, true);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Assign(const Tk&, const Tv&, std::exception_ptr&) */
+		bool Assign(const Tk& _key, const Tv& _value) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Assign(_key, _value, exception);
+		}
+		
+		/**
+		 * @brief Removes the entry with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if an entry was removed, false otherwise.
+		 */
+		bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				const Guard guard(m_Lock);
+				
+				const auto slot = Locate(hash);
+				
+				if (slot != N) {
+					Erase(slot);
+					
+					result = true;
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Remove(const Tk&, std::exception_ptr&) */
+		bool Remove(const Tk& _key) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Remove(_key, exception);
+		}
+		
+		/**
+		 * @brief Retrieves a copy of the value associated with the given key.
+		 * @details A copy is returned, rather than a reference, so that it remains valid once the lock is released.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return The value, or std::nullopt if the key is not present.
+		 */
+		std::optional<Tv> Get(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			std::optional<Tv> result;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				const Guard guard(m_Lock);
+				
+				const auto slot = Locate(hash);
+				
+				if (slot != N) {
+					result.emplace(m_Slots[slot].Entry().second);
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Get(const Tk&, std::exception_ptr&) const */
+		std::optional<Tv> Get(const Tk& _key) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Get(_key, exception);
+		}
+		
+		/**
+		 * @brief Clears all entries from the FixedHashmap.
+		 */
+		void Clear() noexcept {
+			
+			const Guard guard(m_Lock);
+			
+			Destroy();
+		}
+	};
+	
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_FIXEDHASHMAP_HPP
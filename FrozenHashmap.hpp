@@ -0,0 +1,357 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef LOUIERIKSSON_FROZENHASHMAP_HPP
+#define LOUIERIKSSON_FROZENHASHMAP_HPP
+
+#include "Hashmap.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if __has_include(<sys/mman.h>)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	
+	#define LOUIERIKSSON_FROZENHASHMAP_MMAP
+#endif
+
+namespace LouiEriksson {
+	
+	/**
+	 * @brief A read-only Hashmap queried in place from memory written by Hashmap::Freeze.
+	 * @details Opening a FrozenHashmap only validates the header, so it takes O(1) time regardless of the number of entries.
+	 *          When opened from a file, the file is mapped into memory (where supported), so its pages are loaded on demand
+	 *          and shared through the page cache by every process mapping it. Copies of a FrozenHashmap share the same memory.
+	 *          As with Hashmap, keys are compared by hashcode.
+	 *
+	 * @code
+	 * hashmap.Freeze("table.bin");
+	 *
+	 * const auto frozen = LouiEriksson::FrozenHashmap<int, std::string>::Open("table.bin");
+	 *
+	 * if (const auto value = frozen.Get(42)) {
+	 *     std::cout << *value << '\n';
+	 * }
+	 * @endcode
+	 *
+	 * @tparam Tk Key type of the frozen Hashmap. Must be trivially copyable or std::string.
+	 * @tparam Tv Value type of the frozen Hashmap. Must be trivially copyable or std::string.
+	 * @see FrozenLayout
+	 */
+	template<typename Tk, typename Tv>
+	class FrozenHashmap final {
+		
+		static_assert(FrozenLayout::s_Supported<Tk> && FrozenLayout::s_Supported<Tv>, "Only trivially-copyable and string keys and values can be frozen.");
+	
+	public:
+		
+		/** @brief Type through which values are read. Strings are read as views of the underlying memory. */
+		using value_t = std::conditional_t<std::is_same_v<Tv, std::string>, std::string_view, Tv>;
+		
+	private:
+		
+		/** @brief Keeps the underlying memory alive, if it is owned by the FrozenHashmap. */
+		std::shared_ptr<const char> m_Owner;
+		
+		FrozenLayout::Header m_Header {};
+		
+		const char* m_Buckets { nullptr };
+		const char* m_Entries { nullptr };
+		const char* m_Data    { nullptr };
+		
+		static constexpr auto s_Stride = FrozenLayout::EntryOf<Tk, Tv>();
+		
+		/**
+		 * @brief Reads an unsigned 64-bit integer from memory without regard for its alignment.
+		 * @param[in] _memory Memory to read.
+		 * @return The integer.
+		 */
+		static uint64_t Load(const char* _memory) noexcept {
+			
+			uint64_t result;
+			
+			std::memcpy(&result, _memory, sizeof(result));
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Reads the value held in a slot.
+		 * @param[in] _slot The slot.
+		 * @return The value.
+		 * @throw std::runtime_error If a string lies outside of the data section.
+		 */
+		value_t Decode(const char* _slot) const {
+			
+			if constexpr (std::is_same_v<Tv, std::string>) {
+				
+				const auto offset = Load(_slot);
+				const auto length = Load(_slot + sizeof(uint64_t));
+				
+				if (offset > m_Header.m_DataSize || length > m_Header.m_DataSize - offset) {
+					throw std::runtime_error("The frozen Hashmap is corrupt.");
+				}
+				
+				return std::string_view(m_Data + offset, static_cast<size_t>(length));
+			}
+			else {
+				
+				Tv result;
+				
+				std::memcpy(&result, _slot, sizeof(Tv));
+				
+				return result;
+			}
+		}
+		
+		/**
+		 * @brief Finds the entry with the given key.
+		 * @param[in] _key Key of the entry.
+		 * @return The entry, or nullptr if none exists.
+		 * @throw std::runtime_error If the bucket table is corrupt.
+		 */
+		const char* Locate(const Tk& _key) const {
+			
+			const char* result = nullptr;
+			
+			if (m_Entries != nullptr) {
+				
+				const auto hash   = static_cast<uint64_t>(std::hash<Tk>()(_key));
+				const auto bucket = hash % m_Header.m_Buckets;
+				
+				const auto begin = Load(m_Buckets + (bucket * sizeof(uint64_t)));
+				const auto end   = Load(m_Buckets + ((bucket + 1U) * sizeof(uint64_t)));
+				
+				if (begin > end || end > m_Header.m_Count) {
+					throw std::runtime_error("The frozen Hashmap is corrupt.");
+				}
+				
+				for (auto i = begin; i < end; ++i) {
+					
+					const auto* entry = m_Entries + (i * s_Stride);
+					
+					if (Load(entry) == hash) {
+						result = entry;
+						
+						break;
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+	public:
+		
+		/** @brief Constructs an empty FrozenHashmap. */
+		FrozenHashmap() noexcept = default;
+		
+		/**
+		 * @brief Constructs a FrozenHashmap reading from memory written by Hashmap::Freeze.
+		 * @details The memory is not copied, and must outlive the FrozenHashmap and any copies of it.
+		 *
+		 * @param[in] _memory Memory to read from, aligned to 8 bytes.
+		 * @param[in] _length Length of the memory in bytes.
+		 * @throw std::runtime_error If the memory does not contain a compatible frozen Hashmap.
+		 */
+		FrozenHashmap(const void* _memory, const size_t& _length) {
+			
+			const auto* memory = static_cast<const char*>(_memory);
+			
+			if (_length < sizeof(FrozenLayout::Header) || reinterpret_cast<uintptr_t>(memory) % 8U != 0U) {
+				throw std::runtime_error("The memory does not contain a frozen Hashmap.");
+			}
+			
+			std::memcpy(&m_Header, memory, sizeof(m_Header));
+			
+			if (m_Header.m_Magic != FrozenLayout::s_Magic) {
+				throw std::runtime_error("The memory does not contain a frozen Hashmap.");
+			}
+			
+			if (m_Header.m_Version != FrozenLayout::s_Version) {
+				throw std::runtime_error("The memory contains an unsupported version of the frozen Hashmap format.");
+			}
+			
+			if (m_Header.m_KeySize != FrozenLayout::SizeOf<Tk>() || m_Header.m_ValueSize != FrozenLayout::SizeOf<Tv>()) {
+				throw std::runtime_error("The memory contains a frozen Hashmap of different types.");
+			}
+			
+			// Otherwise, every lookup would silently miss.
+			if (m_Header.m_HashSize != sizeof(size_t) || m_Header.m_Probe != FrozenLayout::ProbeOf<Tk>()) {
+				throw std::runtime_error("The memory contains a frozen Hashmap written with a different hash function.");
+			}
+			
+			// Validate only the extents of each section, so that opening does not depend on the number of entries.
+			const auto tableEnd = sizeof(FrozenLayout::Header) + ((m_Header.m_Buckets + 1U) * sizeof(uint64_t));
+			
+			if (m_Header.m_Buckets == 0U ||
+			    m_Header.m_Buckets > _length ||
+			    m_Header.m_Count   > _length / s_Stride ||
+			    m_Header.m_Entries > _length ||
+			    m_Header.m_Entries < tableEnd ||
+			    m_Header.m_Entries % 8U != 0U ||
+			    m_Header.m_Data    < m_Header.m_Entries + (m_Header.m_Count * s_Stride) ||
+			    m_Header.m_Data    > _length ||
+			    m_Header.m_DataSize > _length - m_Header.m_Data
+			) {
+				throw std::runtime_error("The frozen Hashmap is corrupt.");
+			}
+			
+			m_Buckets = memory + sizeof(FrozenLayout::Header);
+			m_Entries = memory + m_Header.m_Entries;
+			m_Data    = memory + m_Header.m_Data;
+		}
+		
+		/**
+		 * @brief Opens a file written by Hashmap::Freeze.
+		 * @details Where supported, the file is mapped into memory read-only and unmapped once the last copy of the FrozenHashmap is destroyed.
+		 *          Otherwise, the file is read into memory.
+		 *
+		 * @param[in] _path Path of the file.
+		 * @return A FrozenHashmap reading from the file.
+		 * @throw std::runtime_error If the file could not be opened, or does not contain a compatible frozen Hashmap.
+		 */
+		static FrozenHashmap Open(const std::string& _path) {
+			
+			std::shared_ptr<const char> memory;
+			size_t length = 0U;
+			
+#ifdef LOUIERIKSSON_FROZENHASHMAP_MMAP
+			
+			const auto file = ::open(_path.c_str(), O_RDONLY);
+			
+			if (file == -1) {
+				throw std::runtime_error("Failed to open \"" + _path + "\" for reading.");
+			}
+			
+			struct stat status {};
+			
+			if (::fstat(file, &status) == -1) {
+				::close(file);
+				
+				throw std::runtime_error("Failed to open \"" + _path + "\" for reading.");
+			}
+			
+			length = static_cast<size_t>(status.st_size);
+			
+			void* mapping = length > 0U ? ::mmap(nullptr, length, PROT_READ, MAP_SHARED, file, 0) : MAP_FAILED;
+			
+			// The mapping remains valid once the file is closed.
+			::close(file);
+			
+			if (mapping == MAP_FAILED) {
+				throw std::runtime_error("Failed to map \"" + _path + "\" into memory.");
+			}
+			
+			memory = std::shared_ptr<const char>(static_cast<const char*>(mapping), [length](const char* _mapping) {
+				::munmap(const_cast<char*>(_mapping), length);
+			});
+#else
+			
+			std::ifstream stream(_path, std::ios::binary | std::ios::ate);
+			
+			if (!stream) {
+				throw std::runtime_error("Failed to open \"" + _path + "\" for reading.");
+			}
+			
+			length = static_cast<size_t>(stream.tellg());
+			
+			// Words rather than characters, so that the buffer satisfies the alignment of the format.
+			std::shared_ptr<uint64_t[]> buffer(new uint64_t[(length + sizeof(uint64_t) - 1U) / sizeof(uint64_t)]);
+			
+			stream.seekg(0);
+			
+			if (!stream.read(reinterpret_cast<char*>(buffer.get()), static_cast<std::streamsize>(length))) {
+				throw std::runtime_error("Failed to read \"" + _path + "\".");
+			}
+			
+			memory = std::shared_ptr<const char>(buffer, reinterpret_cast<const char*>(buffer.get()));
+#endif
+			
+			FrozenHashmap result(memory.get(), length);
+			
+			result.m_Owner = std::move(memory);
+			
+			return result;
+		}
+		
+		[[nodiscard]] size_t size() const noexcept { return static_cast<size_t>(m_Header.m_Count); }
+		
+		[[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+		
+		/**
+		 * @brief Determines whether the frozen Hashmap contains the given key.
+		 * @param[in] _key Key to check for.
+		 * @return True if the key exists, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key) const noexcept {
+			
+			auto result = false;
+			
+			try {
+				result = Locate(_key) != nullptr;
+			}
+			catch (...) {}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Retrieves the value associated with the given key.
+		 * @param[in] _key Key of the entry.
+		 * @return The value, or std::nullopt if the key is not present. String values are views valid for the lifetime of the underlying memory.
+		 */
+		std::optional<value_t> Get(const Tk& _key) const noexcept {
+			
+			std::optional<value_t> result;
+			
+			try {
+				
+				if (const auto* entry = Locate(_key)) {
+					result = Decode(entry + sizeof(uint64_t) + FrozenLayout::SlotOf<Tk>());
+				}
+			}
+			catch (...) {}
+			
+			return result;
+		}
+	};
+	
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_FROZENHASHMAP_HPP
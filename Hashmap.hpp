@@ -28,18 +28,290 @@
 //#define HASHMAP_SUPPRESS_EXCEPTION_WARNING // Uncomment if you wish to remove the warning about possible unhandled exceptions.
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace LouiEriksson {
 	
+	/**
+	 * @brief Default configuration of a Hashmap.
+	 * @details To customise a Hashmap, derive from this struct, shadow the members you wish to change, and pass it as the Hashmap's TPolicy.
+	 *
+	 * @code
+	 * struct Striped : LouiEriksson::HashmapPolicy {
+	 *     static constexpr size_t Stripes = 16U;
+	 * };
+	 *
+	 * LouiEriksson::Hashmap<int, std::string, Striped> hashmap;
+	 * @endcode
+	 */
+	struct HashmapPolicy {
+		
+		/**
+		 * @brief Number of locks the buckets of the Hashmap are striped across.
+		 * @details Operations on keys guarded by different stripes may proceed concurrently, while resizing acquires every stripe.
+		 *          A value of 1 serialises all writers on a single lock.
+		 */
+		static constexpr size_t Stripes = 1U;
+		
+		/**
+		 * @brief Type of lock guarding each stripe. Must satisfy the SharedMutex requirements.
+		 * @details For read-mostly workloads on many cores, consider DistributedSharedMutex (see DistributedSharedMutex.hpp),
+		 *          which spreads readers across cache lines at the cost of slower writes.
+		 */
+		using Mutex = std::shared_mutex;
+		
+		/**
+		 * @brief Whether writers combine their operations rather than each acquiring the lock.
+		 * @details Each thread publishes its Add, Assign or Remove as a request, and whichever thread acquires the combiner lock
+		 *          applies every published request under a single acquisition of the stripes, while the other writers wait for their result.
+		 *          This avoids handing the lock between writers, and keeps the buckets in the cache of the combining thread.
+		 *          Beneficial when many threads write to the same Hashmap at once.
+		 *          As each write waits for every stripe, a thread holding an Accessor or ConstAccessor must not write to the Hashmap.
+		 */
+		static constexpr bool Combining = false;
+		
+		/**
+		 * @brief Size in bytes above which values are stored out of line.
+		 * @details Entries whose value is larger than this are allocated individually, and the buckets hold only pointers to them.
+		 *          Growing a bucket or resizing the Hashmap then moves a pointer per entry rather than the whole value.
+		 *          Set to SIZE_MAX to always store values inline.
+		 */
+		static constexpr size_t OutOfLine = 128U;
+		
+		/**
+		 * @brief Whether the address of each entry remains stable until the entry is removed.
+		 * @details Every entry is stored out of line (see OutOfLine), regardless of its size, and Snapshot copies the Hashmap
+		 *          rather than sharing its buckets, so that writing to the Hashmap after a snapshot never relocates its entries.
+		 *          This allows pointers to values to be held across operations, such as by secondary indexes into the Hashmap.
+		 *          Reading or writing a value through such a pointer must still be synchronised with writes to the same entry.
+		 */
+		static constexpr bool Stable = false;
+	};
+	
+	/** @brief How Hashmap::MergeFrom resolves an entry whose key already exists. */
+	enum class MergeConflict : unsigned char {
+		Keep,   /**< @brief Keep the existing value. */
+		Replace /**< @brief Replace the existing value with the incoming one. */
+	};
+	
+	/**
+	 * @brief Encodes and decodes values of a type for Hashmap::SaveBinary and Hashmap::LoadBinary.
+	 * @details Specialise this struct for your own types, providing the same static members as the specialisations below,
+	 *          or pass a codec with those members to SaveBinary and LoadBinary directly.
+	 *
+	 * @code
+	 * template<>
+	 * struct LouiEriksson::BinaryCodec<Point> {
+	 *
+	 *     static constexpr bool Raw = false;
+	 *
+	 *     static void Write(std::ostream& _stream, const Point& _value) { ... }
+	 *
+	 *     static Point Read(std::istream& _stream) { ... }
+	 * };
+	 * @endcode
+	 *
+	 * @tparam T Type to encode.
+	 */
+	template<typename T, typename = void>
+	struct BinaryCodec;
+	
+	/**
+	 * @brief Encodes trivially-copyable types as their object representation.
+	 * @details Raw codecs are written and read in bulk, rather than one value at a time.
+	 *          The encoding depends on the size and byte order of the type, so files are only portable between similar platforms.
+	 */
+	template<typename T>
+	struct BinaryCodec<T, std::enable_if_t<std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>>> {
+		
+		static constexpr bool Raw = true;
+		
+		static void Write(std::ostream& _stream, const T& _value) {
+			_stream.write(reinterpret_cast<const char*>(&_value), sizeof(T));
+		}
+		
+		static T Read(std::istream& _stream) {
+			
+			T result;
+			
+			_stream.read(reinterpret_cast<char*>(&result), sizeof(T));
+			
+			return result;
+		}
+	};
+	
+	/** @brief Encodes strings as their length followed by their characters. */
+	template<>
+	struct BinaryCodec<std::string> {
+		
+		static constexpr bool Raw = false;
+		
+		static void Write(std::ostream& _stream, const std::string& _value) {
+			
+			const auto length = static_cast<uint64_t>(_value.size());
+			
+			_stream.write(reinterpret_cast<const char*>(&length), sizeof(length));
+			_stream.write(_value.data(), static_cast<std::streamsize>(_value.size()));
+		}
+		
+		static std::string Read(std::istream& _stream) {
+			
+			uint64_t length = 0U;
+			
+			_stream.read(reinterpret_cast<char*>(&length), sizeof(length));
+			
+			std::string result;
+			
+			// Read in bounded pieces, so that a corrupt length fails on the stream rather than on the allocation.
+			while (_stream && result.size() < length) {
+				
+				const auto piece = static_cast<size_t>(std::min<uint64_t>(length - result.size(), 4096U));
+				const auto start = result.size();
+				
+				result.resize(start + piece);
+				
+				_stream.read(&result[start], static_cast<std::streamsize>(piece));
+			}
+			
+			return result;
+		}
+	};
+	
+	/**
+	 * @brief Describes the position-independent, read-only format written by Hashmap::Freeze and read by FrozenHashmap (see FrozenHashmap.hpp).
+	 * @details Every offset is relative to the start of the file, and every section is aligned to 8 bytes, so the file may be mapped at any address.
+	 *          The header is followed by the bucket table, the entries grouped by bucket, and finally the characters of any strings.
+	 *          Each entry consists of its hashcode, a slot for its key and a slot for its value. A slot holds the object representation
+	 *          of a trivially-copyable type, or the offset and length of a string within the data section.
+	 */
+	struct FrozenLayout final {
+		
+		/** @brief Identifies a frozen Hashmap, and the byte order it was written in. */
+		static constexpr uint32_t s_Magic = 0x4C45485AU;
+		
+		/** @brief Version of the format. Incremented whenever the format changes. */
+		static constexpr uint32_t s_Version = 2U;
+		
+		/** @brief The header at the start of a frozen Hashmap. */
+		struct Header final {
+			
+			uint32_t m_Magic;
+			uint32_t m_Version;
+			
+			uint32_t m_KeySize;   /**< @brief Size of a raw key, or zero if the keys are strings. */
+			uint32_t m_ValueSize; /**< @brief Size of a raw value, or zero if the values are strings. */
+			
+			uint32_t m_HashSize; /**< @brief Size of the hashcodes the buckets were assigned by. */
+			uint32_t m_Reserved; /**< @brief Zero. */
+			uint64_t m_Probe;    /**< @brief Hashcode of a fixed key, identifying the hash function the buckets were assigned by. See ProbeOf. */
+			
+			uint64_t m_Count;   /**< @brief Number of entries. */
+			uint64_t m_Buckets; /**< @brief Number of buckets. The bucket table holds one more offset than this, marking the end of the last bucket. */
+			
+			uint64_t m_Entries;  /**< @brief Offset of the entries. */
+			uint64_t m_Data;     /**< @brief Offset of the data section. */
+			uint64_t m_DataSize; /**< @brief Size of the data section. */
+		};
+		
+		/**
+		 * @brief Whether values of a type can be frozen.
+		 * @tparam T Type of the values.
+		 */
+		template<typename T>
+		static constexpr bool s_Supported = std::is_same_v<T, std::string> || (std::is_trivially_copyable_v<T> && alignof(T) <= 8U);
+		
+		/**
+		 * @brief Rounds a size up to a multiple of 8 bytes.
+		 * @param[in] _size The size to round.
+		 * @return The rounded size.
+		 */
+		static constexpr size_t Align(const size_t& _size) noexcept {
+			return (_size + 7U) & ~static_cast<size_t>(7U);
+		}
+		
+		/**
+		 * @brief Returns the size recorded in the header for a type.
+		 * @tparam T Type of the keys or values.
+		 * @return The size of a raw type, or zero for strings.
+		 */
+		template<typename T>
+		static constexpr uint32_t SizeOf() noexcept {
+			
+			if constexpr (std::is_same_v<T, std::string>) {
+				return 0U;
+			}
+			else {
+				return static_cast<uint32_t>(sizeof(T));
+			}
+		}
+		
+		/**
+		 * @brief Returns the hashcode of a fixed key of a type.
+		 * @details Lookups hash keys with std::hash, whose results differ between standard libraries and platforms,
+		 *          so a frozen Hashmap is only readable where hashing this key gives the same result as when it was written.
+		 *
+		 * @tparam T Type of the keys.
+		 * @return The hashcode of the key, or zero if no fixed key can be constructed.
+		 */
+		template<typename T>
+		static uint64_t ProbeOf() {
+			
+			if constexpr (std::is_same_v<T, std::string>) {
+				return static_cast<uint64_t>(std::hash<std::string>()("LouiEriksson::FrozenLayout"));
+			}
+			else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+				return static_cast<uint64_t>(std::hash<T>()(static_cast<T>(0x5A)));
+			}
+			else if constexpr (std::is_default_constructible_v<T>) {
+				return static_cast<uint64_t>(std::hash<T>()(T {}));
+			}
+			else {
+				return 0U;
+			}
+		}
+		
+		/**
+		 * @brief Returns the size of the slot holding a key or value of a type.
+		 * @tparam T Type of the keys or values.
+		 * @return The size of the slot.
+		 */
+		template<typename T>
+		static constexpr size_t SlotOf() noexcept {
+			return std::is_same_v<T, std::string> ? sizeof(uint64_t) * 2U : Align(SizeOf<T>());
+		}
+		
+		/**
+		 * @brief Returns the size of an entry.
+		 * @tparam Tk Type of the keys.
+		 * @tparam Tv Type of the values.
+		 * @return The size of an entry.
+		 */
+		template<typename Tk, typename Tv>
+		static constexpr size_t EntryOf() noexcept {
+			return sizeof(uint64_t) + SlotOf<Tk>() + SlotOf<Tv>();
+		}
+	};
+	
 	/**
 	 * @mainpage Version 2.3.0
 	 * @details Custom Hashmap implementation accepting a customisable key and value type.
@@ -48,11 +320,14 @@ namespace LouiEriksson {
 	 *      Available at: https://www.youtube.com/watch?v=_Q-eNqTOxlE [Accessed 2021].
 	 * @tparam Tk Key type of the Hashmap.
 	 * @tparam Tv Value type of the Hashmap.
+	 * @tparam TPolicy Configuration of the Hashmap. See HashmapPolicy.
 	 */
-	template<typename Tk, typename Tv>
+	template<typename Tk, typename Tv, typename TPolicy = HashmapPolicy>
 	class Hashmap final {
 		
-		inline static std::shared_mutex s_Lock;
+		static_assert(TPolicy::Stripes > 0U, "The Hashmap requires at least one lock stripe.");
+		
+		using Mutex = typename TPolicy::Mutex;
 		
 	public:
 		
@@ -70,6 +345,14 @@ namespace LouiEriksson {
 				 first(_key),
 				second(_value) {}
 			
+			KeyValuePair(const Tk& _key, Tv&& _value) :
+				 first(_key),
+				second(std::move(_value)) {}
+			
+			KeyValuePair(Tk&& _key, Tv&& _value) :
+				 first(std::move(_key)),
+				second(std::move(_value)) {}
+			
 			constexpr KeyValuePair(const KeyValuePair& _other) :
 				 first(_other.first),
 				second(_other.second) {}
@@ -97,252 +380,3092 @@ namespace LouiEriksson {
 	
 	private:
 		
-		/** @brief Buckets of the Hashmap. */
-		std::vector<std::vector<KeyValuePair>> m_Buckets;
-		
-		/** @brief Current number of elements within the Hashmap. */
-		size_t m_Size;
-		
-		/**
-		 * @brief Calculate the hashcode of a given object using std::hash.
-		 * @param[in] _item Item to calculate hash of.
-		 * @return Hashcode of _item.
-		 * @throw std::exception If the type of _item is not supported by std::hash.
-		 */
-		static constexpr size_t GetHashcode(const Tk& _item) {
-			return std::hash<Tk>()(_item);
-		}
-		
-		/**
-		 * @brief Reinitialise the Hashmap. An expensive operation that increases the Hashmap's capacity.
-		 *
-		 * @param _newSize The new size of the Hashmap.
-		 */
-		void Resize(const size_t& _newSize) {
-
-			std::vector<std::vector<KeyValuePair>> shallow_cpy(m_Buckets);
-
-			try {
-
-				m_Size = 0U;
-				m_Buckets.clear();
-				m_Buckets.resize(_newSize > 0U ? _newSize : 1U);
-
-				for (auto& bucket : shallow_cpy) {
-					for (auto& kvp : bucket) {
-
-						auto& k = kvp.first;
-						auto& v = kvp.second;
-
-						if (m_Size >= m_Buckets.size()) {
-							Resize(m_Buckets.size() * 2U);
-						}
-
-						// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-						const auto hash = GetHashcode(k);
-						const auto i = hash % m_Buckets.size();
-
-						auto& bucket = m_Buckets[i];
-
-						auto exists = false;
-						for (auto& kvp : bucket) {
-
-							if (GetHashcode(kvp.first) == hash) {
-								exists = true;
-
-								kvp.second = std::move(v);
-
-								break;
-							}
-						}
-
-						if (!exists) {
-							m_Size++;
-
-							bucket.emplace_back(std::move(k), std::move(v));
-						}
-					}
-				}
-			}
-			catch (const std::exception& e){
-				m_Buckets = shallow_cpy;
-			}
-		}
+		/** @brief Whether entries are allocated individually. See HashmapPolicy::OutOfLine and HashmapPolicy::Stable. */
+		static constexpr bool s_Nodes = TPolicy::Stable || sizeof(Tv) > TPolicy::OutOfLine;
 		
 		/**
-		 * @brief Retrieves a reference to the entry within the Hashmap with the given key, if one exists.
-		 * This method will throw an exception if no entry is found. Consider using Get() for safe access instead.
-		 *
-		 * @param[in] _key Key of the entry to retrieve.
-		 * @return Out value result.
-		 * @throw std::runtime_error If no entry is found.
-		 * @see Get(const Tk& _key, Tv& _out)
+		 * @class NodeBucket
+		 * @brief A bucket holding pointers to individually-allocated entries, with the subset of the interface of std::vector used by the Hashmap.
+		 * @details Its iterators dereference to the entries themselves. Copying a NodeBucket copies its entries.
 		 */
-		const Tv& Return(const Tk& _key) const {
-
-			const Tv* result = nullptr;
+		class NodeBucket final {
 			
-			if (!m_Buckets.empty()) {
+			friend Hashmap;
+			
+		private:
+			
+			using nodes_t = std::vector<std::unique_ptr<KeyValuePair>>;
+			
+			nodes_t m_Nodes;
+			
+			/**
+			 * @brief Random-access iterator over the entries of a NodeBucket.
+			 * @tparam Const Whether the entries are accessed as const.
+			 */
+			template<bool Const>
+			class Iterator final {
 				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				size_t hash = GetHashcode(_key);
-				size_t i = hash % m_Buckets.size();
+				friend NodeBucket;
+				friend Hashmap;
 				
-				auto& bucket = m_Buckets[i];
+			private:
 				
-				for (auto& kvp : bucket) {
-					
-					if (GetHashcode(kvp.first) == hash) {
-						result = &kvp.second;
-						
-						break;
-					}
-				}
-			}
+				using inner_itr = std::conditional_t<Const, typename nodes_t::const_iterator, typename nodes_t::iterator>;
+				
+				inner_itr m_Itr;
+				
+				constexpr explicit Iterator(const inner_itr& _itr) noexcept : m_Itr(_itr) {}
+				
+			public:
+				
+				using iterator_category = std::random_access_iterator_tag;
+				using value_type        = KeyValuePair;
+				using difference_type   = std::ptrdiff_t;
+				using pointer           = std::conditional_t<Const, const KeyValuePair*, KeyValuePair*>;
+				using reference         = std::conditional_t<Const, const KeyValuePair&, KeyValuePair&>;
+				
+				constexpr Iterator() noexcept = default;
+				
+				/** @brief Converts a mutable iterator into a const one. */
+				template<bool Other, typename = std::enable_if_t<Const && !Other>>
+				constexpr Iterator(const Iterator<Other>& _other) noexcept : m_Itr(_other.m_Itr) {}
+				
+				reference operator  *() const { return **m_Itr; }
+				pointer   operator ->() const { return &**m_Itr; }
+				
+				reference operator [](const difference_type& _offset) const { return *m_Itr[_offset]; }
+				
+				Iterator& operator ++() { ++m_Itr; return *this; }
+				Iterator& operator --() { --m_Itr; return *this; }
+				
+				Iterator operator ++(int) { auto result = *this; ++m_Itr; return result; }
+				Iterator operator --(int) { auto result = *this; --m_Itr; return result; }
+				
+				Iterator& operator +=(const difference_type& _offset) { m_Itr += _offset; return *this; }
+				Iterator& operator -=(const difference_type& _offset) { m_Itr -= _offset; return *this; }
+				
+				Iterator operator +(const difference_type& _offset) const { return Iterator(m_Itr + _offset); }
+				Iterator operator -(const difference_type& _offset) const { return Iterator(m_Itr - _offset); }
+				
+				difference_type operator -(const Iterator& _other) const { return m_Itr - _other.m_Itr; }
+				
+				bool operator ==(const Iterator& _other) const { return m_Itr == _other.m_Itr; }
+				bool operator !=(const Iterator& _other) const { return m_Itr != _other.m_Itr; }
+				bool operator  <(const Iterator& _other) const { return m_Itr  < _other.m_Itr; }
+				bool operator <=(const Iterator& _other) const { return m_Itr <= _other.m_Itr; }
+				bool operator  >(const Iterator& _other) const { return m_Itr  > _other.m_Itr; }
+				bool operator >=(const Iterator& _other) const { return m_Itr >= _other.m_Itr; }
+			};
 			
-			if (result == nullptr) {
-				throw std::runtime_error("Attempted to access a nonexistent entry from the Hashmap.");
-			}
+		public:
 			
-			return *result;
-		}
-		
-	public:
-		
-		/**
-		 * @brief Initialise Hashmap.
-		 * @param[in] _capacity Initial capacity of the Hashmap. Must be larger than 0.
-		 */
-		constexpr Hashmap(const size_t& _capacity = 1U) : m_Size(0U) {
-			m_Buckets.resize(_capacity);
-		}
-		
-		/**
-		 * @brief Initialise Hashmap using a collection of key-value pairs.
-		 * @details Please note: The provided collection should be distinct. Otherwise, some data loss may occur as duplicate entries will be ignored.
-		 *
-		 * @param[in] _items A collection of key-value pairs.
-		 * @param[in] _capacity Initial capacity of the Hashmap. If a value less than 1 is assigned, it will use the size of the provided collection.
-		 */
-		constexpr Hashmap(const std::initializer_list<KeyValuePair>& _items, const size_t& _capacity = 0U) : m_Size(0U) {
+			using value_type     = KeyValuePair;
+			using iterator       = Iterator<false>;
+			using const_iterator = Iterator<true>;
 			
-			size_t auto_capacity = _capacity;
+			NodeBucket() noexcept = default;
 			
-			if (auto_capacity < 1U) {
-				auto_capacity = std::max<size_t>(_items.size(), 1U);
+			NodeBucket(const NodeBucket& _other) : m_Nodes() {
+				
+				m_Nodes.reserve(_other.m_Nodes.size());
+				
+				for (const auto& node : _other.m_Nodes) {
+					m_Nodes.emplace_back(std::make_unique<KeyValuePair>(*node));
+				}
 			}
 			
-			m_Buckets.resize(auto_capacity);
+			NodeBucket(NodeBucket&& _rhs) noexcept = default;
 			
-			for (const auto& item : _items) {
-				Assign(item.first, item.second);
+			NodeBucket& operator = (const NodeBucket& _other) {
+				
+				if (this != &_other) {
+					
+					auto copy = _other;
+					
+					m_Nodes = std::move(copy.m_Nodes);
+				}
+				
+				return *this;
 			}
-		}
-		
-		struct optional_ref final {
-		
-			friend Hashmap;
 			
-		private:
+			NodeBucket& operator = (NodeBucket&& _rhs) noexcept = default;
 			
-			using optional_t = std::optional<std::reference_wrapper<const Tv>>;
-		
-			const optional_t m_Optional;
+			[[nodiscard]] iterator       begin()       noexcept { return iterator(m_Nodes.begin()); }
+			[[nodiscard]] iterator         end()       noexcept { return iterator(m_Nodes.end());   }
+			[[nodiscard]] const_iterator begin() const noexcept { return const_iterator(m_Nodes.begin()); }
+			[[nodiscard]] const_iterator   end() const noexcept { return const_iterator(m_Nodes.end());   }
 			
-			explicit optional_ref(optional_t&& _optional) : m_Optional(_optional) {};
+			[[nodiscard]] size_t     size() const noexcept { return m_Nodes.size();     }
+			[[nodiscard]] size_t capacity() const noexcept { return m_Nodes.capacity(); }
+			[[nodiscard]] bool      empty() const noexcept { return m_Nodes.empty();    }
 			
-		public:
+			[[nodiscard]]       KeyValuePair& operator [](const size_t& _index)       { return *m_Nodes[_index]; }
+			[[nodiscard]] const KeyValuePair& operator [](const size_t& _index) const { return *m_Nodes[_index]; }
 			
-			[[nodiscard]] const Tv& value()                 const { return m_Optional.value(); }
-			[[nodiscard]] const Tv& value_or(const Tv&& _t) const { return m_Optional.value_or(_t); }
+			[[nodiscard]]       KeyValuePair& back()       { return *m_Nodes.back(); }
+			[[nodiscard]] const KeyValuePair& back() const { return *m_Nodes.back(); }
 			
-			[[nodiscard]] bool has_value() const { return m_Optional.has_value(); }
+			void reserve(const size_t& _capacity) { m_Nodes.reserve(_capacity); }
 			
-			[[nodiscard]] const Tv& operator  *() const { return  value(); }
-			[[nodiscard]] const Tv* operator ->() const { return &value(); }
+			void clear() noexcept { m_Nodes.clear(); }
 			
-			[[nodiscard]] operator bool() const { return has_value(); }
+			/**
+			 * @brief Allocates a new entry at the end of the bucket.
+			 * @details If an exception is thrown, the bucket is left unchanged.
+			 */
+			template<typename... Args>
+			KeyValuePair& emplace_back(Args&&... _args) {
+				
+				auto node = std::make_unique<KeyValuePair>(std::forward<Args>(_args)...);
+				
+				m_Nodes.emplace_back(std::move(node));
+				
+				return *m_Nodes.back();
+			}
+			
+			iterator erase(const const_iterator& _position) { return iterator(m_Nodes.erase(_position.m_Itr)); }
+			
+			iterator erase(const const_iterator& _first, const const_iterator& _last) { return iterator(m_Nodes.erase(_first.m_Itr, _last.m_Itr)); }
 		};
 		
+		/** @brief Type of each bucket of the Hashmap. */
+		using bucket_t = std::conditional_t<s_Nodes, NodeBucket, std::vector<KeyValuePair>>;
+		
 		/**
-		 * @brief Returns the number of items stored within the Hashmap.
-		 * @return The number of items stored within the Hashmap.
+		 * @brief Moves an entry to the end of another bucket. Out-of-line entries are moved by pointer, leaving the entry where it is in memory.
+		 * @details The source position is left moved-from, and must then be erased. If an exception is thrown, the entry is left unmoved,
+		 *          which cannot happen if the target has spare capacity.
+		 *
+		 * @param[in,out] _target Bucket to append the entry to.
+		 * @param[in] _source Position of the entry.
 		 */
-		[[nodiscard]] const size_t& size() const noexcept {
-			const std::shared_lock lock(s_Lock);
+		static void Transfer(bucket_t& _target, const typename bucket_t::iterator& _source) {
 			
-			return m_Size;
+			if constexpr (s_Nodes) {
+				_target.m_Nodes.emplace_back(std::move(*_source.m_Itr));
+			}
+			else {
+				_target.emplace_back(std::move(*_source));
+			}
+		}
+		
+		/**
+		 * @brief Moves an entry to an earlier, moved-from position of the same bucket, as when compacting a bucket.
+		 *
+		 * @param[in] _target Position to move the entry to.
+		 * @param[in] _source Position of the entry.
+		 */
+		static void Shift(const typename bucket_t::iterator& _target, const typename bucket_t::iterator& _source) noexcept {
+			
+			if constexpr (s_Nodes) {
+				*_target.m_Itr = std::move(*_source.m_Itr);
+			}
+			else {
+				*_target = std::move(*_source);
+			}
+		}
+		
+		/**
+		 * @brief A lock guarding every bucket whose index is congruent to the stripe's index modulo the number of stripes.
+		 * @details Aligned to a cache line so that threads working on neighbouring stripes do not contend on the same line.
+		 */
+		struct alignas(64U) Stripe final {
+			
+			Mutex m_Lock;
+			
+			/**
+			 * @brief Number of elements stored within the buckets guarded by this stripe.
+			 * @details Only modified while holding the stripe exclusively, but may be read without holding it.
+			 *          Kept on its own cache line, so that threads reading the size do not disturb threads acquiring the lock.
+			 */
+			alignas(64U) std::atomic<size_t> m_Size { 0U };
+			
+			/**
+			 * @brief Adjusts the number of elements stored within the stripe. The caller must hold the stripe exclusively.
+			 * @details As there is only ever one writer, the count is updated with a plain load and store rather than a read-modify-write.
+			 *
+			 * @param[in] _delta Change in the number of elements.
+			 */
+			void Adjust(const std::ptrdiff_t& _delta) noexcept {
+				m_Size.store(m_Size.load(std::memory_order_relaxed) + static_cast<size_t>(_delta), std::memory_order_relaxed);
+			}
+		};
+		
+		/** @brief Buckets of the Hashmap. The number of buckets is always a multiple of the number of stripes. */
+		std::vector<bucket_t> m_Buckets;
+		
+		/** @brief Locks guarding the buckets of the Hashmap. */
+		mutable std::array<Stripe, TPolicy::Stripes> m_Stripes;
+		
+		/** @brief Number of buckets of each stripe moved at a time while the Hashmap grows. */
+		static constexpr size_t s_ChunkSize = 64U;
+		
+		/** @brief Identifies the binary format written by SaveBinary, and the byte order it was written in. */
+		static constexpr uint32_t s_BinaryMagic = 0x4C45484DU;
+		
+		/** @brief Version of the binary format written by SaveBinary. Incremented whenever the format changes. */
+		static constexpr uint32_t s_BinaryVersion = 1U;
+		
+		/** @brief Number of entries buffered at a time when saving or loading raw keys and values. */
+		static constexpr size_t s_BinaryBatch = 4096U;
+		
+		/**
+		 * @brief Whether keys and values are saved and loaded in bulk as their object representation.
+		 * @tparam TKeyCodec Codec of the keys.
+		 * @tparam TValueCodec Codec of the values.
+		 */
+		template<typename TKeyCodec, typename TValueCodec>
+		static constexpr bool s_Raw = TKeyCodec::Raw && TValueCodec::Raw && std::is_trivially_copyable_v<Tk> && std::is_trivially_copyable_v<Tv>;
+		
+		/**
+		 * @brief Returns the number of bytes remaining in a stream, if the stream supports seeking.
+		 * @param[in,out] _stream The stream, which is left at its original position.
+		 * @return The number of bytes between the current position and the end of the stream, or std::nullopt if it cannot be determined.
+		 */
+		static std::optional<uint64_t> Remaining(std::istream& _stream) {
+			
+			std::optional<uint64_t> result;
+			
+			const auto position = _stream.tellg();
+			
+			if (position != std::streampos(-1)) {
+				
+				_stream.seekg(0, std::ios::end);
+				
+				const auto end = _stream.tellg();
+				
+				_stream.clear();
+				_stream.seekg(position);
+				
+				if (end != std::streampos(-1) && end >= position) {
+					result = static_cast<uint64_t>(end - position);
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief State of an in-progress resize, during which entries move from m_Buckets to m_Target one chunk at a time.
+		 * @details Rather than one thread moving every entry while holding every stripe, threads inserting into the Hashmap claim and move chunks
+		 *          until none remain. A chunk only contains buckets guarded by a single stripe, and as the new number of buckets is also a multiple of
+		 *          the number of stripes, its entries stay within that stripe. Moving a chunk therefore only requires the one stripe.
+		 *
+		 *          The vectors and generation are only replaced while holding every stripe, and a bucket's flag is only set while holding its stripe.
+		 */
+		struct Migration final {
+			
+			/** @brief Buckets of the Hashmap once the resize completes. */
+			std::vector<bucket_t> m_Target;
+			
+			/** @brief Whether each bucket of m_Buckets has been moved into m_Target. */
+			std::vector<char> m_Moved;
+			
+			/** @brief Distinguishes resizes from one another, so that a chunk claimed during one is never moved during another. */
+			std::uint32_t m_Generation = 0U;
+			
+			std::atomic<bool> m_Active { false };
+			
+			/** @brief Generation (upper 32 bits) and index of the next unclaimed chunk (lower 32 bits). */
+			std::atomic<std::uint64_t> m_Claims { 0U };
+			
+			std::atomic<size_t> m_Chunks    { 0U };
+			std::atomic<size_t> m_Completed { 0U };
+		};
+		
+		Migration m_Migration;
+		
+		/**
+		 * @brief Buckets shared with snapshots of the Hashmap.
+		 * @details Taking a snapshot moves the buckets of the Hashmap into an immutable array shared with the snapshot, leaving every bucket of the Hashmap unowned.
+		 *          An unowned bucket is read from the shared array, and copied from it (becoming owned) the first time it is modified.
+		 *          The shared array, and the flags, are only replaced while holding every stripe, and a bucket's flag is only set while holding its stripe exclusively.
+		 */
+		struct Shared final {
+			
+			/** @brief Buckets shared with snapshots, or nullptr if every bucket is owned. */
+			std::shared_ptr<const std::vector<bucket_t>> m_Buckets;
+			
+			/** @brief Whether each bucket of m_Buckets has been copied from the shared buckets. */
+			std::vector<char> m_Owned;
+			
+			/** @brief Number of snapshots taken of the Hashmap. */
+			size_t m_Version = 0U;
+		};
+		
+		Shared m_Shared;
+		
+		/** @brief Types of write which may be combined. */
+		enum class Operation : unsigned char {
+			Add,
+			Assign,
+			Remove
+		};
+		
+		/**
+		 * @brief A write published by a thread, to be applied by whichever thread holds the combiner lock.
+		 * @details Requests live on the stack of the publishing thread, which waits until the request is done.
+		 */
+		struct Request final {
+			
+			Operation m_Operation;
+			
+			/** @brief Whether the key and value may be moved from. */
+			bool m_Movable;
+			
+			const Tk* m_Key;
+			const Tv* m_Value;
+			
+			bool m_Result = false;
+			
+			std::exception_ptr m_Exception;
+			
+			std::atomic<bool> m_Done { false };
+			
+			Request* m_Next = nullptr;
+		};
+		
+		/** @brief State shared by the writers of a combining Hashmap. */
+		struct Combiner final {
+			
+			std::mutex m_Lock;
+			
+			/** @brief Stack of requests awaiting the combining thread. */
+			alignas(64U) std::atomic<Request*> m_Pending { nullptr };
+		};
+		
+		std::conditional_t<TPolicy::Combining, Combiner, std::tuple<>> m_Combiner;
+		
+		/**
+		 * @brief Calculate the hashcode of a given object using std::hash.
+		 * @param[in] _item Item to calculate hash of.
+		 * @return Hashcode of _item.
+		 * @throw std::exception If the type of _item is not supported by std::hash.
+		 */
+		static constexpr size_t GetHashcode(const Tk& _item) {
+			return std::hash<Tk>()(_item);
+		}
+		
+		/**
+		 * @brief Rounds a capacity up to the nearest valid number of buckets.
+		 * @param[in] _capacity The requested capacity.
+		 * @return The smallest non-zero multiple of the number of stripes which is not less than _capacity.
+		 */
+		static constexpr size_t Align(const size_t& _capacity) noexcept {
+			return std::max<size_t>((_capacity + TPolicy::Stripes - 1U) / TPolicy::Stripes, 1U) * TPolicy::Stripes;
+		}
+		
+		/**
+		 * @brief Mixes a hashcode (the finaliser of MurmurHash3) before it is used to select a bucket or stripe.
+		 * @details std::hash is often the identity, so without mixing, keys sharing a factor with the number of stripes would collapse into a single stripe and a fraction of the buckets.
+		 *          Keys are still compared by their unmixed hashcode.
+		 *
+		 * @param[in] _hash Hashcode of the key.
+		 * @return The mixed hashcode.
+		 */
+		static constexpr size_t Spread(const size_t& _hash) noexcept {
+			
+			auto result = static_cast<uint64_t>(_hash);
+			
+			result ^= result >> 33U;
+			result *= 0xFF51AFD7ED558CCDULL;
+			result ^= result >> 33U;
+			result *= 0xC4CEB9FE1A85EC53ULL;
+			result ^= result >> 33U;
+			
+			return static_cast<size_t>(result);
+		}
+		
+		/**
+		 * @brief Returns the stripe guarding the bucket which the given hash maps to.
+		 * @details As the number of buckets is a multiple of the number of stripes, the stripe depends only on the hash and not on the capacity of the Hashmap.
+		 *
+		 * @param[in] _hash Hashcode of the key.
+		 * @return The stripe guarding the key.
+		 */
+		Stripe& StripeOf(const size_t& _hash) const noexcept {
+			return m_Stripes[Spread(_hash) % TPolicy::Stripes];
+		}
+		
+		/**
+		 * @brief Acquires every stripe in ascending order, granting access to the entire Hashmap.
+		 * @tparam TLock Type of lock to acquire each stripe with (std::shared_lock or std::unique_lock).
+		 * @return The acquired locks.
+		 */
+		template<typename TLock>
+		std::array<TLock, TPolicy::Stripes> LockAll() const {
+			
+			std::array<TLock, TPolicy::Stripes> result;
+			
+			for (size_t i = 0U; i < TPolicy::Stripes; ++i) {
+				result[i] = TLock(m_Stripes[i].m_Lock);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns the bucket which the given hash maps to. The caller must hold the hash's stripe.
+		 * @param[in] _hash Hashcode of the key.
+		 * @return The bucket, or nullptr if the Hashmap has no buckets.
+		 */
+		const bucket_t* BucketOf(const size_t& _hash) const noexcept {
+			
+			const bucket_t* result = nullptr;
+			
+			if (!m_Buckets.empty()) {
+				
+				// Create an index by taking the key's mixed hash value and "wrapping" it with the number of buckets.
+				const auto spread = Spread(_hash);
+				const auto i = spread % m_Buckets.size();
+				
+				if (m_Migration.m_Active.load(std::memory_order_relaxed) && m_Migration.m_Moved[i] != 0) {
+					result = &m_Migration.m_Target[spread % m_Migration.m_Target.size()];
+				}
+				else if (m_Shared.m_Buckets != nullptr && m_Shared.m_Owned[i] == 0) {
+					result = &(*m_Shared.m_Buckets)[i];
+				}
+				else {
+					result = &m_Buckets[i];
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns the bucket which the given hash maps to for modification. The caller must hold the hash's stripe exclusively.
+		 * @details A bucket still shared with a snapshot is copied first.
+		 *
+		 * @param[in] _hash Hashcode of the key.
+		 * @return The bucket, or nullptr if the Hashmap has no buckets.
+		 * @throw std::bad_alloc If a shared bucket could not be copied.
+		 */
+		bucket_t* BucketOf(const size_t& _hash) {
+			
+			if (m_Shared.m_Buckets != nullptr && !m_Buckets.empty()) {
+				
+				const auto i = Spread(_hash) % m_Buckets.size();
+				
+				Own(i);
+			}
+			
+			return const_cast<bucket_t*>(std::as_const(*this).BucketOf(_hash));
+		}
+		
+		/**
+		 * @brief Copies a bucket shared with a snapshot, if it is not already owned. The caller must hold the bucket's stripe exclusively.
+		 * @param[in] _index Index of the bucket.
+		 */
+		void Own(const size_t& _index) {
+			
+			if (m_Shared.m_Owned[_index] == 0) {
+				
+				auto copy = (*m_Shared.m_Buckets)[_index];
+				
+				m_Buckets[_index] = std::move(copy);
+				
+				m_Shared.m_Owned[_index] = 1;
+			}
+		}
+		
+		/**
+		 * @brief Copies every bucket still shared with a snapshot, and stops sharing buckets. The caller must hold every stripe exclusively.
+		 * @details If no snapshot remains, the shared buckets are moved rather than copied.
+		 */
+		void Thaw() {
+			
+			if (m_Shared.m_Buckets != nullptr) {
+				
+				if (m_Shared.m_Buckets.use_count() == 1) {
+					
+					// Synchronise with the release of the last snapshot, which may have been read on another thread.
+					std::atomic_thread_fence(std::memory_order_acquire);
+					
+					// The shared buckets were created mutable, and are no longer shared.
+					auto& buckets = const_cast<std::vector<bucket_t>&>(*m_Shared.m_Buckets);
+					
+					for (size_t i = 0U; i < m_Buckets.size(); ++i) {
+						
+						if (m_Shared.m_Owned[i] == 0) {
+							m_Buckets[i] = std::move(buckets[i]);
+						}
+					}
+				}
+				else {
+					
+					for (size_t i = 0U; i < m_Buckets.size(); ++i) {
+						Own(i);
+					}
+				}
+				
+				Detach();
+			}
+		}
+		
+		/**
+		 * @brief Stops sharing buckets with snapshots, discarding any bucket which is not owned. The caller must hold every stripe exclusively.
+		 */
+		void Detach() noexcept {
+			m_Shared.m_Buckets.reset();
+			m_Shared.m_Owned = std::vector<char>();
+		}
+		
+		/**
+		 * @brief Invokes a function on every bucket containing entries, including those already moved by an in-progress resize or shared with a snapshot.
+		 * @details The caller must hold every stripe.
+		 *
+		 * @param[in] _function Function accepting a bucket.
+		 */
+		template<typename Tf>
+		void ForEachBucket(Tf&& _function) const {
+			
+			const auto migrating = m_Migration.m_Active.load(std::memory_order_relaxed);
+			
+			for (size_t i = 0U; i < m_Buckets.size(); ++i) {
+				
+				if (m_Shared.m_Buckets != nullptr && m_Shared.m_Owned[i] == 0) {
+					_function((*m_Shared.m_Buckets)[i]);
+				}
+				else if (!migrating || m_Migration.m_Moved[i] == 0) {
+					_function(m_Buckets[i]);
+				}
+			}
+			
+			if (migrating) {
+				
+				for (const auto& bucket : m_Migration.m_Target) {
+					_function(bucket);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Returns the target of the in-progress resize, or nullptr if the Hashmap is not being resized.
+		 * @details Buckets of m_Buckets already moved into the target are left empty.
+		 */
+		const std::vector<bucket_t>* Target() const noexcept {
+			return m_Migration.m_Active.load(std::memory_order_relaxed) ? &m_Migration.m_Target : nullptr;
+		}
+		
+		/**
+		 * @brief Returns the number of buckets the Hashmap has, or will have once an in-progress resize completes.
+		 * @return The capacity of the Hashmap.
+		 */
+		size_t Capacity() const noexcept {
+			return m_Migration.m_Active.load(std::memory_order_relaxed) ? m_Migration.m_Target.size() : m_Buckets.size();
+		}
+		
+		/**
+		 * @brief Returns the number of elements across all stripes.
+		 * @details If the caller does not hold every stripe, the result reflects each stripe at a slightly different moment.
+		 *
+		 * @return The number of items stored within the Hashmap.
+		 */
+		size_t Count() const noexcept {
+			
+			size_t result = 0U;
+			
+			for (const auto& stripe : m_Stripes) {
+				result += stripe.m_Size.load(std::memory_order_relaxed);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Moves a bucket of m_Buckets into the target of the in-progress resize. The caller must hold the bucket's stripe exclusively.
+		 * @details If an exception is thrown, the bucket is left unmoved.
+		 *
+		 * @param[in] _index Index of the bucket.
+		 */
+		void MoveBucket(const size_t& _index) {
+			
+			auto& source = m_Buckets[_index];
+			auto& target = m_Migration.m_Target;
+			
+			if (!source.empty()) {
+				
+				// Determine the destination of every entry and reserve the destination buckets up-front,
+				// so that relocating the entries cannot fail part-way through.
+				std::vector<size_t> destinations;
+				destinations.reserve(source.size());
+				
+				for (const auto& kvp : source) {
+					
+					const auto i = Spread(GetHashcode(kvp.first)) % target.size();
+					
+					if (target[i].size() == target[i].capacity()) {
+						target[i].reserve(target[i].size() + source.size());
+					}
+					
+					destinations.emplace_back(i);
+				}
+				
+				for (size_t i = 0U; i < source.size(); ++i) {
+					Transfer(target[destinations[i]], source.begin() + static_cast<std::ptrdiff_t>(i));
+				}
+				
+				source = bucket_t();
+			}
+			
+			m_Migration.m_Moved[_index] = 1;
+		}
+		
+		/**
+		 * @brief Moves every bucket of a chunk which has not already been moved. The caller must hold the chunk's stripe exclusively.
+		 * @details Chunk c covers s_ChunkSize consecutive buckets of stripe (c % Stripes), starting from that stripe's (c / Stripes) * s_ChunkSize-th bucket.
+		 *
+		 * @param[in] _chunk Index of the chunk.
+		 */
+		void MoveChunk(const size_t& _chunk) {
+			
+			const auto stripe = _chunk % TPolicy::Stripes;
+			const auto first  = (_chunk / TPolicy::Stripes) * s_ChunkSize;
+			
+			for (size_t j = first; j < first + s_ChunkSize; ++j) {
+				
+				const auto i = stripe + (j * TPolicy::Stripes);
+				
+				if (i >= m_Buckets.size()) {
+					break;
+				}
+				
+				if (m_Migration.m_Moved[i] == 0) {
+					MoveBucket(i);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Starts a resize, to be completed by subsequent calls to Help(). The caller must hold every stripe exclusively.
+		 * @param[in] _newSize The new size of the Hashmap.
+		 */
+		void Begin(const size_t& _newSize) {
+			
+			std::vector<bucket_t> target(Align(_newSize));
+			std::vector<char> moved(m_Buckets.size(), 0);
+			
+			m_Migration.m_Target = std::move(target);
+			m_Migration.m_Moved  = std::move(moved);
+			
+			const auto chunks = ((m_Buckets.size() / TPolicy::Stripes) + s_ChunkSize - 1U) / s_ChunkSize * TPolicy::Stripes;
+			
+			m_Migration.m_Generation++;
+			m_Migration.m_Chunks.store(chunks, std::memory_order_relaxed);
+			m_Migration.m_Completed.store(0U, std::memory_order_relaxed);
+			m_Migration.m_Claims.store(static_cast<std::uint64_t>(m_Migration.m_Generation) << 32U, std::memory_order_relaxed);
+			m_Migration.m_Active.store(true, std::memory_order_release);
+		}
+		
+		/**
+		 * @brief Completes any in-progress resize by moving the remaining buckets, and stops sharing buckets with snapshots.
+		 * @details Afterwards, every entry is held within m_Buckets. The caller must hold every stripe exclusively.
+		 */
+		void Finish() {
+			
+			if (m_Migration.m_Active.load(std::memory_order_relaxed)) {
+				
+				for (size_t i = 0U; i < m_Buckets.size(); ++i) {
+					
+					if (m_Migration.m_Moved[i] == 0) {
+						MoveBucket(i);
+					}
+				}
+				
+				m_Buckets = std::move(m_Migration.m_Target);
+				
+				Abandon();
+			}
+			
+			Thaw();
+		}
+		
+		/**
+		 * @brief Discards the state of any in-progress resize. The caller must hold every stripe exclusively.
+		 */
+		void Abandon() noexcept {
+			
+			m_Migration.m_Active.store(false, std::memory_order_relaxed);
+			
+			m_Migration.m_Target = std::vector<bucket_t>();
+			m_Migration.m_Moved  = std::vector<char>();
+		}
+		
+		/**
+		 * @brief Takes over the in-progress resize of another Hashmap. The caller must hold every stripe of both Hashmaps exclusively.
+		 * @param[in,out] _other The Hashmap to take the resize from.
+		 */
+		void Adopt(Hashmap& _other) noexcept {
+			
+			Abandon();
+			
+			if (_other.m_Migration.m_Active.load(std::memory_order_relaxed)) {
+				
+				auto& migration = _other.m_Migration;
+				
+				// Start a new generation, so that chunks claimed from this Hashmap's previous resize are not moved again.
+				m_Migration.m_Generation = std::max(m_Migration.m_Generation, migration.m_Generation) + 1U;
+				
+				m_Migration.m_Target = std::move(migration.m_Target);
+				m_Migration.m_Moved  = std::move(migration.m_Moved);
+				
+				const auto next = migration.m_Claims.load(std::memory_order_relaxed) & 0xFFFFFFFFU;
+				
+				m_Migration.m_Chunks.store(migration.m_Chunks.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				m_Migration.m_Completed.store(migration.m_Completed.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				m_Migration.m_Claims.store((static_cast<std::uint64_t>(m_Migration.m_Generation) << 32U) | next, std::memory_order_relaxed);
+				m_Migration.m_Active.store(true, std::memory_order_release);
+				
+				_other.Abandon();
+			}
+		}
+		
+		/**
+		 * @brief Moves unclaimed chunks of an in-progress resize until none remain.
+		 * @details The thread which moves the final chunk acquires every stripe and completes the resize.
+		 *          Failures are not reported to the helping thread, whose own operation is unrelated: a chunk whose move failed still counts as completed,
+		 *          and its remaining buckets are moved when the resize is completed. If completing the resize fails, it is retried by the next Grow, Trim or Reserve.
+		 */
+		void Help() noexcept {
+			
+			if (m_Migration.m_Active.load(std::memory_order_acquire)) {
+				
+				auto claims = m_Migration.m_Claims.load(std::memory_order_acquire);
+				
+				for (;;) {
+					
+					const auto generation = static_cast<std::uint32_t>(claims >> 32U);
+					const auto chunk      = static_cast<size_t>(claims & 0xFFFFFFFFU);
+					
+					if (chunk >= m_Migration.m_Chunks.load(std::memory_order_acquire)) {
+						break;
+					}
+					
+					if (!m_Migration.m_Claims.compare_exchange_weak(claims, claims + 1U, std::memory_order_acq_rel, std::memory_order_acquire)) {
+						continue;
+					}
+					
+					auto last = false;
+					
+					try {
+						
+						const std::unique_lock lock(m_Stripes[chunk % TPolicy::Stripes].m_Lock);
+						
+						// The resize may have been completed by another thread since the chunk was claimed.
+						if (!m_Migration.m_Active.load(std::memory_order_relaxed) || m_Migration.m_Generation != generation) {
+							break;
+						}
+						
+						try {
+							MoveChunk(chunk);
+						}
+						catch (...) {
+							// The buckets which were not moved remain flagged, and are moved by Finish.
+						}
+						
+						last = m_Migration.m_Completed.fetch_add(1U, std::memory_order_acq_rel) + 1U == m_Migration.m_Chunks.load(std::memory_order_relaxed);
+					}
+					catch (...) {
+						// The stripe could not be acquired, so the chunk is left for the next Grow, Trim or Reserve to complete the resize with.
+						break;
+					}
+					
+					if (last) {
+						
+						try {
+						
+							const auto all = LockAll<std::unique_lock<Mutex>>();
+							
+							if (m_Migration.m_Generation == generation) {
+								Finish();
+							}
+						}
+						catch (...) {
+							// Every entry remains reachable while the resize is active, so it is left for the next Grow, Trim or Reserve to complete.
+						}
+						
+						break;
+					}
+					
+					claims = m_Migration.m_Claims.load(std::memory_order_acquire);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Returns whether the Hashmap should grow before an entry is inserted into the given stripe.
+		 * @details The Hashmap grows once it holds as many entries as it has buckets. The stripe's own share is checked first as it is cheaper than counting every stripe,
+		 *          and whenever the Hashmap is at capacity at least one stripe is at or above its share, so growth is never missed for long.
+		 *
+		 * @param[in] _stripe The stripe about to be inserted into.
+		 * @return True if the Hashmap is at capacity.
+		 */
+		bool Full(const Stripe& _stripe) const noexcept {
+			
+			const auto capacity = Capacity();
+			
+			return _stripe.m_Size.load(std::memory_order_relaxed) * TPolicy::Stripes >= capacity && Count() >= capacity;
+		}
+		
+		/**
+		 * @brief Grows the Hashmap if it is at capacity (see Full).
+		 * @details Small Hashmaps are resized immediately. Larger Hashmaps begin a resize which is then shared between the threads inserting into it.
+		 *
+		 * @param[in] _stripe The stripe about to be inserted into.
+		 */
+		void Grow(const Stripe& _stripe) {
+			
+			const auto all = LockAll<std::unique_lock<Mutex>>();
+			
+			if (Full(_stripe)) {
+				
+				Finish();
+				
+				if (m_Buckets.size() <= s_ChunkSize * TPolicy::Stripes) {
+					Resize(m_Buckets.size() * 2U);
+				}
+				else {
+					Begin(m_Buckets.size() * 2U);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Acquires exclusive ownership of the stripe guarding the given hash, growing the Hashmap beforehand if it is at capacity.
+		 * @details Growing requires every stripe, so the stripe is released and all stripes are acquired in order before the Hashmap is resized.
+		 *          Before acquiring the stripe, the caller helps to complete any in-progress resize.
+		 *
+		 * @param[in] _hash Hashcode of the key about to be inserted.
+		 * @return A lock owning the stripe.
+		 */
+		std::unique_lock<Mutex> LockForInsert(const size_t& _hash) {
+			
+			auto& stripe = StripeOf(_hash);
+			
+			for (;;) {
+			
+				Help();
+				
+				std::unique_lock lock(stripe.m_Lock);
+				
+				if (!Full(stripe)) {
+					return lock;
+				}
+				
+				lock.unlock();
+				
+				Grow(stripe);
+			}
+		}
+		
+		/**
+		 * @brief Reinitialise the Hashmap. An expensive operation that changes the Hashmap's capacity.
+		 * @details The caller must hold every stripe exclusively, and every entry must be held within m_Buckets (see Finish). If an exception is thrown, the Hashmap is left unchanged.
+		 *
+		 * @param _newSize The new size of the Hashmap.
+		 */
+		void Resize(const size_t& _newSize) {
+			
+			std::vector<bucket_t> buckets(Align(_newSize));
+			
+			// Determine the destination of every entry and reserve the destination buckets up-front,
+			// so that relocating the entries cannot fail part-way through.
+			std::vector<size_t> destinations;
+			destinations.reserve(Count());
+			
+			{
+				std::vector<size_t> counts(buckets.size(), 0U);
+				
+				for (const auto& bucket : m_Buckets) {
+					for (const auto& kvp : bucket) {
+						
+						// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
+						const auto i = Spread(GetHashcode(kvp.first)) % buckets.size();
+						
+						destinations.emplace_back(i);
+						counts[i]++;
+					}
+				}
+				
+				for (size_t i = 0U; i < buckets.size(); ++i) {
+					buckets[i].reserve(counts[i]);
+				}
+			}
+			
+			auto destination = destinations.begin();
+			
+			for (auto& bucket : m_Buckets) {
+				for (auto itr = bucket.begin(); itr != bucket.end(); ++itr) {
+					Transfer(buckets[*(destination++)], itr);
+				}
+			}
+			
+			m_Buckets = std::move(buckets);
+		}
+		
+		/**
+		 * @brief Retrieves a reference to the entry within the Hashmap with the given key, if one exists.
+		 * This method will throw an exception if no entry is found. Consider using Get() for safe access instead.
+		 *
+		 * @param[in] _key Key of the entry to retrieve.
+		 * @return Out value result.
+		 * @throw std::runtime_error If no entry is found.
+		 * @see Get(const Tk& _key, Tv& _out)
+		 */
+		const Tv& Return(const Tk& _key) const {
+
+			const Tv* result = nullptr;
+			
+			const auto hash = GetHashcode(_key);
+				
+			if (const auto* target = BucketOf(hash)) {
+				
+				const auto& bucket = *target;
+				
+				for (auto& kvp : bucket) {
+					
+					if (GetHashcode(kvp.first) == hash) {
+						result = &kvp.second;
+						
+						break;
+					}
+				}
+			}
+			
+			if (result == nullptr) {
+				throw std::runtime_error("Attempted to access a nonexistent entry from the Hashmap.");
+			}
+			
+			return *result;
+		}
+		
+		/**
+		 * @brief Inserts or replaces an entry, growing the Hashmap if required. The caller must hold every stripe exclusively.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[in] _replace Whether to replace the value of an existing entry.
+		 * @param[in] _movable Whether the key and value may be moved from. Only true if both refer to non-const objects.
+		 * @return True if a new entry was inserted, false if the key already existed.
+		 */
+		bool Store(const Tk& _key, const Tv& _value, const bool& _replace, const bool& _movable) {
+			
+			auto result = true;
+			
+			const auto hash = GetHashcode(_key);
+			
+			if (auto* target = BucketOf(hash)) {
+				
+				for (auto& kvp : *target) {
+					
+					if (GetHashcode(kvp.first) == hash) {
+						result = false;
+						
+						if (_replace) {
+							
+							if (_movable) {
+								kvp.second = std::move(const_cast<Tv&>(_value));
+							}
+							else {
+								kvp.second = _value;
+							}
+						}
+						
+						break;
+					}
+				}
+			}
+			
+			if (result) {
+				
+				// Construct the entry before growing, as the key or value may refer to an entry which growing would relocate.
+				auto entry = _movable ?
+					KeyValuePair(std::move(const_cast<Tk&>(_key)), std::move(const_cast<Tv&>(_value))) :
+					KeyValuePair(_key, _value);
+				
+				auto& stripe = StripeOf(hash);
+				
+				if (Full(stripe)) {
+					
+					Finish();
+					
+					Resize(m_Buckets.size() * 2U);
+				}
+				
+				BucketOf(hash)->emplace_back(std::move(entry));
+				
+				stripe.Adjust(1);
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Removes an entry. The caller must hold every stripe exclusively.
+		 * @param[in] _key Key of the entry.
+		 * @return True if an entry was removed, false otherwise.
+		 */
+		bool Erase(const Tk& _key) {
+			
+			auto result = false;
+			
+			const auto hash = GetHashcode(_key);
+			
+			if (auto* target = BucketOf(hash)) {
+				
+				auto& bucket = *target;
+				
+				for (auto itr = bucket.begin(); itr < bucket.end(); itr++) {
+					
+					if (GetHashcode(itr->first) == hash) {
+						result = true;
+						
+						bucket.erase(itr);
+						
+						StripeOf(hash).Adjust(-1);
+						
+						break;
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Finds the entry with the given key. The caller must hold the key's stripe.
+		 * @param[in] _key Key of the entry.
+		 * @return The entry, or nullptr if none exists.
+		 */
+		const KeyValuePair* Locate(const Tk& _key) const {
+			
+			const KeyValuePair* result = nullptr;
+			
+			const auto hash = GetHashcode(_key);
+			
+			if (const auto* target = BucketOf(hash)) {
+				
+				for (const auto& kvp : *target) {
+					
+					if (GetHashcode(kvp.first) == hash) {
+						result = &kvp;
+						
+						break;
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Invokes a function once per worker index, running the workers concurrently.
+		 * @details The calling thread runs the first worker. If a thread cannot be started, its worker runs on the calling thread instead.
+		 *
+		 * @param[in] _workers Number of workers.
+		 * @param[in] _function Function accepting the index of a worker.
+		 * @throw std::exception The first exception thrown by any worker, once every worker has finished.
+		 */
+		template<typename Tf>
+		static void Parallel(const size_t& _workers, Tf&& _function) {
+			
+			std::vector<std::exception_ptr> exceptions(_workers);
+			
+			const auto work = [&exceptions, &_function](const size_t& _index) noexcept {
+				
+				try {
+					_function(_index);
+				}
+				catch (...) {
+					exceptions[_index] = std::current_exception();
+				}
+			};
+			
+			std::vector<std::thread> threads;
+			threads.reserve(_workers);
+			
+			for (size_t i = 1U; i < _workers; ++i) {
+				
+				try {
+					threads.emplace_back(work, i);
+				}
+				catch (...) {
+					work(i);
+				}
+			}
+			
+			work(0U);
+			
+			for (auto& thread : threads) {
+				thread.join();
+			}
+			
+			for (const auto& exception : exceptions) {
+				
+				if (exception) {
+					std::rethrow_exception(exception);
+				}
+			}
+		}
+		
+		/**
+		 * @brief Applies every published request under a single acquisition of the stripes. The caller must hold the combiner lock.
+		 */
+		void ApplyRequests() noexcept {
+			
+			try {
+				
+				const auto lock = LockAll<std::unique_lock<Mutex>>();
+				
+				auto* request = m_Combiner.m_Pending.exchange(nullptr, std::memory_order_acquire);
+				
+				while (request != nullptr) {
+					
+					// The publishing thread may destroy the request as soon as it is done, so read its successor first.
+					auto* next = request->m_Next;
+					
+					try {
+						
+						switch (request->m_Operation) {
+							case Operation::Add: {
+								request->m_Result = Store(*request->m_Key, *request->m_Value, false, request->m_Movable);
+								break;
+							}
+							case Operation::Assign: {
+								request->m_Result = Store(*request->m_Key, *request->m_Value, true, request->m_Movable);
+								break;
+							}
+							case Operation::Remove: {
+								request->m_Result = Erase(*request->m_Key);
+								break;
+							}
+						}
+					}
+					catch (...) {
+						request->m_Exception = std::current_exception();
+					}
+					
+					request->m_Done.store(true, std::memory_order_release);
+					
+					request = next;
+				}
+			}
+			catch (...) {}
+		}
+		
+		/**
+		 * @brief Publishes a write for the combining thread to apply, and waits for its result.
+		 * @details The calling thread becomes the combining thread if no other thread is.
+		 *
+		 * @param[in] _operation Type of write.
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry, or nullptr when removing.
+		 * @param[in] _movable Whether the key and value may be moved from.
+		 * @param[out] _exception A pointer to any exception caught while applying the write.
+		 * @return The result of the write.
+		 */
+		bool Combine(const Operation& _operation, const Tk& _key, const Tv* _value, const bool& _movable, std::exception_ptr& _exception) noexcept {
+			
+			Request request { _operation, _movable, &_key, _value, false, nullptr, { false }, nullptr };
+			
+			request.m_Next = m_Combiner.m_Pending.load(std::memory_order_relaxed);
+			while (!m_Combiner.m_Pending.compare_exchange_weak(request.m_Next, &request, std::memory_order_release, std::memory_order_relaxed));
+			
+			while (!request.m_Done.load(std::memory_order_acquire)) {
+				
+				if (m_Combiner.m_Lock.try_lock()) {
+					
+					ApplyRequests();
+					
+					m_Combiner.m_Lock.unlock();
+				}
+				else {
+					std::this_thread::yield();
+				}
+			}
+			
+			if (request.m_Exception) {
+				_exception = std::move(request.m_Exception);
+			}
+			
+			return request.m_Result;
+		}
+		
+	public:
+		
+		/**
+		 * @brief Initialise Hashmap.
+		 * @param[in] _capacity Initial capacity of the Hashmap. Must be larger than 0.
+		 */
+		constexpr Hashmap(const size_t& _capacity = 1U) {
+			m_Buckets.resize(Align(_capacity));
+		}
+		
+		/**
+		 * @brief Initialise Hashmap using a collection of key-value pairs.
+		 * @details Please note: The provided collection should be distinct. Otherwise, some data loss may occur as duplicate entries will be ignored.
+		 *
+		 * @param[in] _items A collection of key-value pairs.
+		 * @param[in] _capacity Initial capacity of the Hashmap. If a value less than 1 is assigned, it will use the size of the provided collection.
+		 */
+		constexpr Hashmap(const std::initializer_list<KeyValuePair>& _items, const size_t& _capacity = 0U) {
+			
+			size_t auto_capacity = _capacity;
+			
+			if (auto_capacity < 1U) {
+				auto_capacity = std::max<size_t>(_items.size(), 1U);
+			}
+			
+			m_Buckets.resize(Align(auto_capacity));
+			
+			for (const auto& item : _items) {
+				Assign(item.first, item.second);
+			}
+		}
+		
+		/**
+		 * @brief Initialise Hashmap as a copy of another.
+		 * @param[in] _other The Hashmap to copy.
+		 */
+		Hashmap(const Hashmap& _other) {
+			
+			const auto lock = _other.template LockAll<std::shared_lock<Mutex>>();
+			
+			if (_other.m_Migration.m_Active.load(std::memory_order_relaxed)) {
+				
+				// Gather the entries of the other Hashmap's in-progress resize into its target capacity.
+				m_Buckets.resize(_other.m_Migration.m_Target.size());
+				
+				_other.ForEachBucket([this](const bucket_t& _bucket) {
+					
+					for (const auto& kvp : _bucket) {
+						m_Buckets[Spread(GetHashcode(kvp.first)) % m_Buckets.size()].emplace_back(kvp);
+					}
+				});
+			}
+			else {
+				
+				m_Buckets = _other.m_Buckets;
+				
+				// Share the buckets which the other Hashmap shares with its snapshots.
+				m_Shared.m_Buckets = _other.m_Shared.m_Buckets;
+				m_Shared.m_Owned   = _other.m_Shared.m_Owned;
+			}
+			
+			for (size_t i = 0U; i < TPolicy::Stripes; ++i) {
+				m_Stripes[i].m_Size.store(_other.m_Stripes[i].m_Size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+		}
+		
+		/**
+		 * @brief Initialise Hashmap by taking ownership of the contents of another.
+		 * @details The other Hashmap is left empty.
+		 *
+		 * @param[in] _rhs The Hashmap to move from.
+		 */
+		Hashmap(Hashmap&& _rhs) noexcept {
+			
+			const auto lock = _rhs.template LockAll<std::unique_lock<Mutex>>();
+			
+			m_Buckets = std::move(_rhs.m_Buckets);
+			_rhs.m_Buckets.clear();
+			
+			Adopt(_rhs);
+			
+			m_Shared.m_Buckets = std::move(_rhs.m_Shared.m_Buckets);
+			m_Shared.m_Owned   = std::move(_rhs.m_Shared.m_Owned);
+			
+			_rhs.Detach();
+			
+			for (size_t i = 0U; i < TPolicy::Stripes; ++i) {
+				m_Stripes[i].m_Size.store(_rhs.m_Stripes[i].m_Size.exchange(0U, std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+		}
+		
+		Hashmap& operator = (const Hashmap& _other) {
+			
+			if (this != &_other) {
+				
+				Hashmap copy(_other);
+				
+				const auto lock = LockAll<std::unique_lock<Mutex>>();
+				
+				m_Buckets = std::move(copy.m_Buckets);
+				
+				Abandon();
+				
+				m_Shared.m_Buckets = std::move(copy.m_Shared.m_Buckets);
+				m_Shared.m_Owned   = std::move(copy.m_Shared.m_Owned);
+				
+				for (size_t i = 0U; i < TPolicy::Stripes; ++i) {
+					m_Stripes[i].m_Size.store(copy.m_Stripes[i].m_Size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				}
+			}
+			
+			return *this;
+		}
+		
+		Hashmap& operator = (Hashmap&& _rhs) noexcept {
+			
+			if (this != &_rhs) {
+				
+				Hashmap moved(std::move(_rhs));
+				
+				const auto lock = LockAll<std::unique_lock<Mutex>>();
+				
+				m_Buckets = std::move(moved.m_Buckets);
+				
+				Adopt(moved);
+				
+				m_Shared.m_Buckets = std::move(moved.m_Shared.m_Buckets);
+				m_Shared.m_Owned   = std::move(moved.m_Shared.m_Owned);
+				
+				for (size_t i = 0U; i < TPolicy::Stripes; ++i) {
+					m_Stripes[i].m_Size.store(moved.m_Stripes[i].m_Size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				}
+			}
+			
+			return *this;
+		}
+		
+		struct optional_ref final {
+		
+			friend Hashmap;
+			
+		private:
+			
+			using optional_t = std::optional<std::reference_wrapper<const Tv>>;
+		
+			const optional_t m_Optional;
+			
+			explicit optional_ref(optional_t&& _optional) : m_Optional(_optional) {};
+			
+		public:
+			
+			[[nodiscard]] const Tv& value()                 const { return m_Optional.value(); }
+			[[nodiscard]] const Tv& value_or(const Tv&& _t) const { return m_Optional.value_or(_t); }
+			
+			[[nodiscard]] bool has_value() const { return m_Optional.has_value(); }
+			
+			[[nodiscard]] const Tv& operator  *() const { return  value(); }
+			[[nodiscard]] const Tv* operator ->() const { return &value(); }
+			
+			[[nodiscard]] operator bool() const { return has_value(); }
+		};
+		
+		/**
+		 * @class ConstAccessor
+		 * @brief Provides read-only access to an entry of the Hashmap while holding a shared lock.
+		 * @details The lock is held until the accessor is released or destroyed, so the referenced entry cannot be modified or relocated in the meantime.
+		 *          Writing to the same stripe of the Hashmap, or resizing it, from the thread holding the accessor will deadlock.
+		 *          If the policy enables Combining, every write is applied while holding every stripe, so no write may be made to the Hashmap
+		 *          from the thread holding the accessor, regardless of stripe.
+		 */
+		class ConstAccessor final {
+		
+			friend Hashmap;
+			
+		private:
+			
+			std::shared_lock<Mutex> m_Lock;
+			
+			const KeyValuePair* m_Entry;
+			
+		public:
+			
+			ConstAccessor() noexcept : m_Entry(nullptr) {}
+			
+			ConstAccessor(const ConstAccessor& _other) = delete;
+			ConstAccessor& operator = (const ConstAccessor& _other) = delete;
+			
+			ConstAccessor(ConstAccessor&& _rhs) noexcept = default;
+			ConstAccessor& operator = (ConstAccessor&& _rhs) noexcept = default;
+			
+			/** @brief Releases the lock and detaches the accessor from its entry. */
+			void release() noexcept {
+				
+				m_Entry = nullptr;
+				
+				if (m_Lock.owns_lock()) {
+					m_Lock.unlock();
+				}
+			}
+			
+			[[nodiscard]] bool empty() const noexcept { return m_Entry == nullptr; }
+			
+			[[nodiscard]] const Tk&   key() const { return m_Entry->first;  }
+			[[nodiscard]] const Tv& value() const { return m_Entry->second; }
+			
+			[[nodiscard]] const Tv& operator  *() const { return  value(); }
+			[[nodiscard]] const Tv* operator ->() const { return &value(); }
+			
+			[[nodiscard]] operator bool() const noexcept { return !empty(); }
+		};
+		
+		/**
+		 * @class Accessor
+		 * @brief Provides mutable access to an entry of the Hashmap while holding an exclusive lock.
+		 * @details The lock is held until the accessor is released or destroyed, allowing the value to be modified in place without copying.
+		 *          Accessing the same stripe of the Hashmap, or resizing it, from the thread holding the accessor will deadlock.
+		 *          If the policy enables Combining, every write is applied while holding every stripe, so no write may be made to the Hashmap
+		 *          from the thread holding the accessor, regardless of stripe.
+		 */
+		class Accessor final {
+		
+			friend Hashmap;
+			
+		private:
+			
+			std::unique_lock<Mutex> m_Lock;
+			
+			KeyValuePair* m_Entry;
+			
+		public:
+			
+			Accessor() noexcept : m_Entry(nullptr) {}
+			
+			Accessor(const Accessor& _other) = delete;
+			Accessor& operator = (const Accessor& _other) = delete;
+			
+			Accessor(Accessor&& _rhs) noexcept = default;
+			Accessor& operator = (Accessor&& _rhs) noexcept = default;
+			
+			/** @brief Releases the lock and detaches the accessor from its entry. */
+			void release() noexcept {
+				
+				m_Entry = nullptr;
+				
+				if (m_Lock.owns_lock()) {
+					m_Lock.unlock();
+				}
+			}
+			
+			[[nodiscard]] bool empty() const noexcept { return m_Entry == nullptr; }
+			
+			[[nodiscard]] const Tk&   key() const { return m_Entry->first;  }
+			[[nodiscard]]       Tv& value() const { return m_Entry->second; }
+			
+			[[nodiscard]] Tv& operator  *() const { return  value(); }
+			[[nodiscard]] Tv* operator ->() const { return &value(); }
+			
+			[[nodiscard]] operator bool() const noexcept { return !empty(); }
+		};
+		
+		/**
+		 * @class ReadView
+		 * @brief Read-only access to the entire Hashmap while holding every stripe in shared mode. See Hashmap::ReadTransaction.
+		 * @details Reads through the view acquire no locks and observe a single consistent state of the Hashmap.
+		 *          References returned by the view remain valid until it is destroyed. Writing to the Hashmap from the thread holding the view will deadlock.
+		 */
+		class ReadView final {
+			
+			friend Hashmap;
+			
+		private:
+			
+			const Hashmap* m_Hashmap;
+			
+			std::array<std::shared_lock<Mutex>, TPolicy::Stripes> m_Locks;
+			
+			explicit ReadView(const Hashmap& _hashmap) :
+				m_Hashmap(&_hashmap),
+				m_Locks(_hashmap.template LockAll<std::shared_lock<Mutex>>()) {}
+			
+		public:
+			
+			ReadView(const ReadView& _other) = delete;
+			ReadView& operator = (const ReadView& _other) = delete;
+			
+			ReadView(ReadView&& _rhs) noexcept = default;
+			ReadView& operator = (ReadView&& _rhs) noexcept = default;
+			
+			[[nodiscard]] size_t size() const noexcept { return m_Hashmap->Count(); }
+			
+			[[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+			
+			/**
+			 * @brief Determines whether the Hashmap contains the given key.
+			 * @param[in] _key Key to check for.
+			 * @return True if the key exists, false otherwise.
+			 */
+			bool ContainsKey(const Tk& _key) const noexcept {
+				
+				auto result = false;
+				
+				try {
+					result = m_Hashmap->Locate(_key) != nullptr;
+				}
+				catch (...) {}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Retrieves the value associated with the given key.
+			 * @param[in] _key Key of the entry.
+			 * @return An optional reference to the value, valid for the lifetime of the view, or std::nullopt if the key is not present.
+			 */
+			optional_ref Get(const Tk& _key) const noexcept {
+				
+				typename optional_ref::optional_t result = std::nullopt;
+				
+				try {
+					
+					if (const auto* entry = m_Hashmap->Locate(_key)) {
+						result = std::cref(entry->second);
+					}
+				}
+				catch (...) {}
+				
+				return optional_ref(std::move(result));
+			}
+		};
+		
+		/**
+		 * @class View
+		 * @brief Exclusive access to the entire Hashmap while holding every stripe. See Hashmap::Transaction.
+		 * @details Operations through the view acquire no locks, so a sequence of them is atomic with respect to other threads.
+		 *          Using the Hashmap itself (rather than the view) from the thread holding the view will deadlock.
+		 */
+		class View final {
+			
+			friend Hashmap;
+			
+		private:
+			
+			Hashmap* m_Hashmap;
+			
+			std::array<std::unique_lock<Mutex>, TPolicy::Stripes> m_Locks;
+			
+			explicit View(Hashmap& _hashmap) :
+				m_Hashmap(&_hashmap),
+				m_Locks(_hashmap.template LockAll<std::unique_lock<Mutex>>()) {}
+			
+		public:
+			
+			View(const View& _other) = delete;
+			View& operator = (const View& _other) = delete;
+			
+			View(View&& _rhs) noexcept = default;
+			View& operator = (View&& _rhs) noexcept = default;
+			
+			[[nodiscard]] size_t size() const noexcept { return m_Hashmap->Count(); }
+			
+			[[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+			
+			/** @copydoc ReadView::ContainsKey */
+			bool ContainsKey(const Tk& _key) const noexcept {
+				
+				auto result = false;
+				
+				try {
+					result = m_Hashmap->Locate(_key) != nullptr;
+				}
+				catch (...) {}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Retrieves the value associated with the given key.
+			 * @param[in] _key Key of the entry.
+			 * @return An optional reference to the value, valid until the Hashmap is modified through the view or the view is destroyed, or std::nullopt if the key is not present.
+			 */
+			optional_ref Get(const Tk& _key) const noexcept {
+				
+				typename optional_ref::optional_t result = std::nullopt;
+				
+				try {
+					
+					if (const auto* entry = m_Hashmap->Locate(_key)) {
+						result = std::cref(entry->second);
+					}
+				}
+				catch (...) {}
+				
+				return optional_ref(std::move(result));
+			}
+			
+			/**
+			 * @brief Inserts a new entry with the given key and value, if one does not already exist.
+			 *
+			 * @param[in] _key Key of the entry.
+			 * @param[in] _value Value of the entry.
+			 * @param[out] _exception A pointer to any exception caught during the operation.
+			 * @return True if successful, false otherwise.
+			 */
+			bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+				
+				auto result = false;
+				
+				try {
+					result = m_Hashmap->Store(_key, _value, false, false);
+				}
+				catch (...) {
+					_exception = std::current_exception();
+				}
+				
+				return result;
+			}
+			
+			/** @copydoc Add(const Tk&, const Tv&, std::exception_ptr&) */
+			bool Add(const Tk& _key, const Tv& _value) noexcept {
+				
+				std::exception_ptr exception;
+				
+				return Add(_key, _value, exception);
+			}
+			
+			/**
+			 * @brief Inserts or replaces the entry with the given key.
+			 *
+			 * @param[in] _key Key of the entry.
+			 * @param[in] _value Value of the entry.
+			 * @param[out] _exception A pointer to any exception caught during the operation.
+			 */
+			void Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+				
+				try {
+					m_Hashmap->Store(_key, _value, true, false);
+				}
+				catch (...) {
+					_exception = std::current_exception();
+				}
+			}
+			
+			/** @copydoc Assign(const Tk&, const Tv&, std::exception_ptr&) */
+			void Assign(const Tk& _key, const Tv& _value) noexcept {
+				
+				std::exception_ptr exception;
+				
+				Assign(_key, _value, exception);
+			}
+			
+			/**
+			 * @brief Inserts or replaces the entry with the given key using move semantics.
+			 *
+			 * @param[in] _key Key of the entry.
+			 * @param[in] _value Value of the entry.
+			 * @param[out] _exception A pointer to any exception caught during the operation.
+			 */
+			void Assign(Tk&& _key, Tv&& _value, std::exception_ptr& _exception) noexcept {
+				
+				try {
+					m_Hashmap->Store(_key, _value, true, true);
+				}
+				catch (...) {
+					_exception = std::current_exception();
+				}
+			}
+			
+			/** @copydoc Assign(Tk&&, Tv&&, std::exception_ptr&) */
+			void Assign(Tk&& _key, Tv&& _value) noexcept {
+				
+				std::exception_ptr exception;
+				
+				Assign(std::move(_key), std::move(_value), exception);
+			}
+			
+			/**
+			 * @brief Removes the entry with the given key.
+			 *
+			 * @param[in] _key Key of the entry.
+			 * @param[out] _exception A pointer to any exception caught during the operation.
+			 * @return True if successful, false otherwise.
+			 */
+			bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+				
+				auto result = false;
+				
+				try {
+					result = m_Hashmap->Erase(_key);
+				}
+				catch (...) {
+					_exception = std::current_exception();
+				}
+				
+				return result;
+			}
+			
+			/** @copydoc Remove(const Tk&, std::exception_ptr&) */
+			bool Remove(const Tk& _key) noexcept {
+				
+				std::exception_ptr exception;
+				
+				return Remove(_key, exception);
+			}
+		};
+		
+		/**
+		 * @class Node
+		 * @brief Owns an entry extracted from a Hashmap, which can be inserted into another Hashmap without copying its key or value.
+		 * @details Out-of-line entries remain in their allocation, which the Node takes over from the bucket and hands to the bucket it is inserted into.
+		 * @see Extract(const Tk&)
+		 * @see Insert(Node&&)
+		 */
+		class Node final {
+			
+			friend Hashmap;
+			
+		private:
+			
+			std::conditional_t<s_Nodes, std::unique_ptr<KeyValuePair>, std::optional<KeyValuePair>> m_Entry;
+			
+		public:
+			
+			Node() noexcept = default;
+			
+			Node(const Node& _other) = delete;
+			Node& operator = (const Node& _other) = delete;
+			
+			Node(Node&& _rhs) noexcept = default;
+			Node& operator = (Node&& _rhs) noexcept = default;
+			
+			[[nodiscard]] bool empty() const noexcept { return !m_Entry; }
+			
+			/** @throw std::bad_optional_access If the Node is empty. */
+			[[nodiscard]] const Tk& key() const {
+				
+				if (empty()) {
+					throw std::bad_optional_access();
+				}
+				
+				return m_Entry->first;
+			}
+			
+			/** @throw std::bad_optional_access If the Node is empty. */
+			[[nodiscard]] Tv& value() {
+				
+				if (empty()) {
+					throw std::bad_optional_access();
+				}
+				
+				return m_Entry->second;
+			}
+			
+			[[nodiscard]] operator bool() const noexcept { return !empty(); }
+		};
+		
+		/**
+		 * @brief Returns the number of items stored within the Hashmap.
+		 * @details Wait-free: the count of each stripe is read without acquiring any lock, so polling the size never blocks writers.
+		 *          While writers are active, the result is a momentary approximation.
+		 *
+		 * @return The number of items stored within the Hashmap.
+		 */
+		[[nodiscard]] size_t size() const noexcept {
+			return Count();
 		}
 		
 		/**
 		 * @brief Is the Hashmap empty?
 		 * @return Returns true if the Hashmap contains no entries.
 		 */
-		[[nodiscard]] bool empty() const noexcept {
-			return size() == 0U;
+		[[nodiscard]] bool empty() const noexcept {
+			return size() == 0U;
+		}
+
+		/**
+		 * @brief Queries for the existence of an item in the Hashmap.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @return True if successful, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key) const noexcept {
+
+			auto result = false;
+
+			try {
+
+				const size_t hash = GetHashcode(_key);
+				const std::shared_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+
+					for (auto& kvp : bucket) {
+
+						if (GetHashcode(kvp.first) == hash) {
+							result = true;
+
+							break;
+						}
+					}
+				}
+			}
+			catch (...) {}
+
+			return result;
+		}
+
+		/**
+		 * @brief Queries for the existence of an item in the Hashmap.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const size_t hash = GetHashcode(_key);
+				const std::shared_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+					
+					for (auto& kvp : bucket) {
+						
+						if (GetHashcode(kvp.first) == hash) {
+							result = true;
+							
+							break;
+						}
+					}
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+
+		/**
+		 * @brief Inserts a new entry into the Hashmap with given key and value, if one does not already exist.
+		 * If you are trying to modify an existing key, see Hashmap::Assign.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value) noexcept {
+
+			if constexpr (TPolicy::Combining) {
+				
+				std::exception_ptr exception;
+				
+				return Combine(Operation::Add, _key, &_value, false, exception);
+			}
+			
+			auto result = true;
+
+			try {
+
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+
+				auto& bucket = *BucketOf(hash);
+
+				// In the case of a hash collision, determine if the key is unique.
+				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
+				for (auto& kvp : bucket) {
+					if (GetHashcode(kvp.first) == hash) {
+						result = false;
+
+						break;
+					}
+				}
+
+				// Insert the item into the bucket.
+				if (result) {
+					StripeOf(hash).Adjust(1);
+
+					bucket.emplace_back(_key, _value);
+				}
+			}
+			catch (...) {}
+
+			return result;
+		}
+
+		/**
+		 * @brief Inserts a new entry into the Hashmap with given key and value, if one does not already exist.
+		 * If you are trying to modify an existing key, see Hashmap::Assign.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			if constexpr (TPolicy::Combining) {
+				
+				return Combine(Operation::Add, _key, &_value, false, _exception);
+			}
+			
+			auto result = true;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				// In the case of a hash collision, determine if the key is unique.
+				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
+				for (auto& kvp : bucket) {
+					if (GetHashcode(kvp.first) == hash) {
+						result = false;
+						
+						break;
+					}
+				}
+				
+				// Insert the item into the bucket.
+				if (result) {
+					StripeOf(hash).Adjust(1);
+					
+					bucket.emplace_back(_key, _value);
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+
+		/**
+		 * @brief Inserts a new entry into the Hashmap with given key and value using move semantics, if one does not already exist.
+		 * If you are trying to modify an existing key, see Hashmap::Assign.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk&& _key, const Tv&& _value) noexcept {
+
+			if constexpr (TPolicy::Combining) {
+				
+				std::exception_ptr exception;
+				
+				return Combine(Operation::Add, _key, &_value, false, exception);
+			}
+			
+			auto result = true;
+
+			try {
+
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+
+				auto& bucket = *BucketOf(hash);
+
+				// In the case of a hash collision, determine if the key is unique.
+				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
+				for (auto& kvp : bucket) {
+					if (GetHashcode(kvp.first) == hash) {
+						result = false;
+
+						break;
+					}
+				}
+
+				// Insert the item into the bucket.
+				if (result) {
+					StripeOf(hash).Adjust(1);
+
+					bucket.emplace_back(_key, _value);
+				}
+			}
+			catch (...) {}
+
+			return result;
+		}
+
+		/**
+		 * @brief Inserts a new entry into the Hashmap with given key and value using move semantics, if one does not already exist.
+		 * If you are trying to modify an existing key, see Hashmap::Assign.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk&& _key, const Tv&& _value, std::exception_ptr& _exception) noexcept {
+			
+			if constexpr (TPolicy::Combining) {
+				
+				return Combine(Operation::Add, _key, &_value, false, _exception);
+			}
+			
+			auto result = true;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				// In the case of a hash collision, determine if the key is unique.
+				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
+				for (auto& kvp : bucket) {
+					if (GetHashcode(kvp.first) == hash) {
+						result = false;
+						
+						break;
+					}
+				}
+				
+				// Insert the item into the bucket.
+				if (result) {
+					StripeOf(hash).Adjust(1);
+					
+					bucket.emplace_back(_key, _value);
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+
+		/**
+		 * @brief Inserts or replaces an entry within the Hashmap with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 */
+		void Assign(const Tk& _key, const Tv& _value) noexcept {
+
+			if constexpr (TPolicy::Combining) {
+				
+				std::exception_ptr exception;
+				
+				Combine(Operation::Assign, _key, &_value, false, exception);
+				
+				return;
+			}
+			
+			try {
+
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+
+				auto& bucket = *BucketOf(hash);
+
+				auto exists = false;
+				for (auto& kvp : bucket) {
+
+					if (GetHashcode(kvp.first) == hash) {
+						exists = true;
+
+						kvp.second = _value;
+
+						break;
+					}
+				}
+
+				if (!exists) {
+					StripeOf(hash).Adjust(1);
+
+					bucket.emplace_back(_key, _value);
+				}
+			}
+			catch (...) {}
+		}
+
+		/**
+		 * @brief Inserts or replaces an entry within the Hashmap with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 */
+		void Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			if constexpr (TPolicy::Combining) {
+				
+				Combine(Operation::Assign, _key, &_value, false, _exception);
+				
+				return;
+			}
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				auto exists = false;
+				for (auto& kvp : bucket) {
+					
+					if (GetHashcode(kvp.first) == hash) {
+						exists = true;
+						
+						kvp.second = _value;
+						
+						break;
+					}
+				}
+				
+				if (!exists) {
+					StripeOf(hash).Adjust(1);
+					
+					bucket.emplace_back(_key, _value);
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+		}
+
+		/**
+		 * @brief Inserts or replaces an entry within the Hashmap with the given key using move semantics.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 */
+		void Assign(Tk&& _key, Tv&& _value) noexcept {
+
+			if constexpr (TPolicy::Combining) {
+				
+				std::exception_ptr exception;
+				
+				Combine(Operation::Assign, _key, &_value, true, exception);
+				
+				return;
+			}
+			
+			try {
+
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+
+				auto& bucket = *BucketOf(hash);
+
+				auto exists = false;
+				for (auto& kvp : bucket) {
+
+					if (GetHashcode(kvp.first) == hash) {
+						exists = true;
+
+						kvp.second = std::move(_value);
+
+						break;
+					}
+				}
+
+				if (!exists) {
+					StripeOf(hash).Adjust(1);
+
+					bucket.emplace_back(std::move(_key), std::move(_value));
+				}
+			}
+			catch (...) {}
+		}
+
+		/**
+		 * @brief Inserts or replaces an entry within the Hashmap with the given key using move semantics.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 */
+		void Assign(Tk&& _key, Tv&& _value, std::exception_ptr& _exception) noexcept {
+			
+			if constexpr (TPolicy::Combining) {
+				
+				Combine(Operation::Assign, _key, &_value, true, _exception);
+				
+				return;
+			}
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				auto exists = false;
+				for (auto& kvp : bucket) {
+					
+					if (GetHashcode(kvp.first) == hash) {
+						exists = true;
+						
+						kvp.second = std::move(_value);
+						
+						break;
+					}
+				}
+				
+				if (!exists) {
+					StripeOf(hash).Adjust(1);
+					
+					bucket.emplace_back(std::move(_key), std::move(_value));
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+		}
+
+		/**
+		 * @brief Retrieves the value associated with the given key, inserting the result of a factory if no entry exists.
+		 * @details The lookup and insertion are performed as a single operation under one lock, so the factory is invoked at most once per missing key.
+		 *
+		 * @tparam Tf Callable type with the signature Tv(const Tk&).
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _factory Callable producing the value to insert if no entry exists.
+		 * @return An optional reference to the existing or inserted value, or std::nullopt if the operation failed.
+		 */
+		template<typename Tf>
+		optional_ref GetOrAdd(const Tk& _key, Tf&& _factory) noexcept {
+			
+			typename optional_ref::optional_t result = std::nullopt;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				for (auto& kvp : bucket) {
+					
+					if (GetHashcode(kvp.first) == hash) {
+						result = std::cref(kvp.second);
+						
+						break;
+					}
+				}
+				
+				if (!result) {
+					bucket.emplace_back(_key, _factory(_key));
+					
+					StripeOf(hash).Adjust(1);
+					
+					result = std::cref(bucket.back().second);
+				}
+			}
+			catch (...) {}
+			
+			return optional_ref(std::move(result));
+		}
+		
+		/**
+		 * @brief Retrieves the value associated with the given key, inserting the result of a factory if no entry exists.
+		 * @details The lookup and insertion are performed as a single operation under one lock, so the factory is invoked at most once per missing key.
+		 *
+		 * @tparam Tf Callable type with the signature Tv(const Tk&).
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _factory Callable producing the value to insert if no entry exists.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return An optional reference to the existing or inserted value, or std::nullopt if the operation failed.
+		 */
+		template<typename Tf>
+		optional_ref GetOrAdd(const Tk& _key, Tf&& _factory, std::exception_ptr& _exception) noexcept {
+			
+			typename optional_ref::optional_t result = std::nullopt;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				for (auto& kvp : bucket) {
+					
+					if (GetHashcode(kvp.first) == hash) {
+						result = std::cref(kvp.second);
+						
+						break;
+					}
+				}
+				
+				if (!result) {
+					bucket.emplace_back(_key, _factory(_key));
+					
+					StripeOf(hash).Adjust(1);
+					
+					result = std::cref(bucket.back().second);
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return optional_ref(std::move(result));
+		}
+		
+		/**
+		 * @brief Inserts a new entry with the given value if no entry exists, otherwise updates the existing value in place.
+		 * @details The lookup and update are performed as a single operation under one lock, making this suitable for counters and accumulators.
+		 *
+		 * @tparam Tf Callable type with the signature void(Tv&).
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _addValue Value to insert if no entry exists.
+		 * @param[in] _update Callable which modifies the existing value in place.
+		 * @return An optional reference to the inserted or updated value, or std::nullopt if the operation failed.
+		 */
+		template<typename Tf>
+		optional_ref AddOrUpdate(const Tk& _key, const Tv& _addValue, Tf&& _update) noexcept {
+			
+			typename optional_ref::optional_t result = std::nullopt;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				for (auto& kvp : bucket) {
+					
+					if (GetHashcode(kvp.first) == hash) {
+						_update(kvp.second);
+						
+						result = std::cref(kvp.second);
+						
+						break;
+					}
+				}
+				
+				if (!result) {
+					bucket.emplace_back(_key, _addValue);
+					
+					StripeOf(hash).Adjust(1);
+					
+					result = std::cref(bucket.back().second);
+				}
+			}
+			catch (...) {}
+			
+			return optional_ref(std::move(result));
+		}
+		
+		/**
+		 * @brief Inserts a new entry with the given value if no entry exists, otherwise updates the existing value in place.
+		 * @details The lookup and update are performed as a single operation under one lock, making this suitable for counters and accumulators.
+		 *
+		 * @tparam Tf Callable type with the signature void(Tv&).
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _addValue Value to insert if no entry exists.
+		 * @param[in] _update Callable which modifies the existing value in place.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return An optional reference to the inserted or updated value, or std::nullopt if the operation failed.
+		 */
+		template<typename Tf>
+		optional_ref AddOrUpdate(const Tk& _key, const Tv& _addValue, Tf&& _update, std::exception_ptr& _exception) noexcept {
+			
+			typename optional_ref::optional_t result = std::nullopt;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				for (auto& kvp : bucket) {
+					
+					if (GetHashcode(kvp.first) == hash) {
+						_update(kvp.second);
+						
+						result = std::cref(kvp.second);
+						
+						break;
+					}
+				}
+				
+				if (!result) {
+					bucket.emplace_back(_key, _addValue);
+					
+					StripeOf(hash).Adjust(1);
+					
+					result = std::cref(bucket.back().second);
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return optional_ref(std::move(result));
+		}
+		
+		/**
+		 * @brief Inserts, modifies or removes the entry with the given key using a single callable.
+		 * @details The callable receives the stored value (or a value-initialised Tv if no entry exists) and may modify it in place.
+		 *          Returning true keeps or inserts the entry, returning false removes it (or declines the insertion).
+		 *          The lookup and modification are performed as a single operation under one lock.
+		 *
+		 * @tparam Tf Callable type with the signature bool(Tv& _value, bool _exists).
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _function Callable computing the new state of the entry.
+		 * @return An optional reference to the resulting value, or std::nullopt if the entry is absent afterwards or the operation failed.
+		 */
+		template<typename Tf>
+		optional_ref Compute(const Tk& _key, Tf&& _function) noexcept {
+			
+			typename optional_ref::optional_t result = std::nullopt;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				auto exists = false;
+				for (auto itr = bucket.begin(); itr < bucket.end(); itr++) {
+					
+					if (GetHashcode(itr->first) == hash) {
+						exists = true;
+						
+						if (_function(itr->second, true)) {
+							result = std::cref(itr->second);
+						}
+						else {
+							bucket.erase(itr);
+							
+							StripeOf(hash).Adjust(-1);
+						}
+						
+						break;
+					}
+				}
+				
+				if (!exists) {
+					
+					Tv value {};
+					
+					if (_function(value, false)) {
+						bucket.emplace_back(_key, std::move(value));
+						
+						StripeOf(hash).Adjust(1);
+						
+						result = std::cref(bucket.back().second);
+					}
+				}
+			}
+			catch (...) {}
+			
+			return optional_ref(std::move(result));
+		}
+		
+		/**
+		 * @brief Inserts, modifies or removes the entry with the given key using a single callable.
+		 * @details The callable receives the stored value (or a value-initialised Tv if no entry exists) and may modify it in place.
+		 *          Returning true keeps or inserts the entry, returning false removes it (or declines the insertion).
+		 *          The lookup and modification are performed as a single operation under one lock.
+		 *
+		 * @tparam Tf Callable type with the signature bool(Tv& _value, bool _exists).
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _function Callable computing the new state of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return An optional reference to the resulting value, or std::nullopt if the entry is absent afterwards or the operation failed.
+		 */
+		template<typename Tf>
+		optional_ref Compute(const Tk& _key, Tf&& _function, std::exception_ptr& _exception) noexcept {
+			
+			typename optional_ref::optional_t result = std::nullopt;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				auto exists = false;
+				for (auto itr = bucket.begin(); itr < bucket.end(); itr++) {
+					
+					if (GetHashcode(itr->first) == hash) {
+						exists = true;
+						
+						if (_function(itr->second, true)) {
+							result = std::cref(itr->second);
+						}
+						else {
+							bucket.erase(itr);
+							
+							StripeOf(hash).Adjust(-1);
+						}
+						
+						break;
+					}
+				}
+				
+				if (!exists) {
+					
+					Tv value {};
+					
+					if (_function(value, false)) {
+						bucket.emplace_back(_key, std::move(value));
+						
+						StripeOf(hash).Adjust(1);
+						
+						result = std::cref(bucket.back().second);
+					}
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return optional_ref(std::move(result));
+		}
+		
+		/**
+		 * @brief Removes entry with given key from the Hashmap.
+		 *
+		 * @param[in] _key Key of the entry to be removed.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Remove(const Tk& _key) noexcept {
+
+			if constexpr (TPolicy::Combining) {
+				
+				std::exception_ptr exception;
+				
+				return Combine(Operation::Remove, _key, nullptr, false, exception);
+			}
+			
+			bool result = false;
+
+			try {
+
+				const size_t hash = GetHashcode(_key);
+				const std::unique_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+
+					// In the case of accessing a "collided" hash, find the value in the bucket using equality checks.
+					for (auto itr = bucket.begin(); itr < bucket.end(); itr++) {
+
+						if (GetHashcode(itr->first) == hash) {
+							result = true;
+
+							bucket.erase(itr);
+
+							break;
+						}
+					}
+
+					StripeOf(hash).Adjust(-static_cast<std::ptrdiff_t>(result));
+				}
+			}
+			catch (...) {}
+
+			return result;
+		}
+
+		/**
+		 * @brief Removes entry with given key from the Hashmap.
+		 *
+		 * @param[in] _key Key of the entry to be removed.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+			
+			if constexpr (TPolicy::Combining) {
+				
+				return Combine(Operation::Remove, _key, nullptr, false, _exception);
+			}
+			
+			bool result = false;
+			
+			try {
+				
+				const size_t hash = GetHashcode(_key);
+				const std::unique_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+					
+					// In the case of accessing a "collided" hash, find the value in the bucket using equality checks.
+					for (auto itr = bucket.begin(); itr < bucket.end(); itr++) {
+						
+						if (GetHashcode(itr->first) == hash) {
+							result = true;
+							
+							bucket.erase(itr);
+							
+							break;
+						}
+					}
+					
+					StripeOf(hash).Adjust(-static_cast<std::ptrdiff_t>(result));
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+
+		/**
+		 * @brief Retrieves the value associated with the given key from the fnv1a table.
+		 *
+		 * @tparam Tk The type of the key.
+		 * @param[in] _key The key to retrieve the value for.
+		 * @return An optional reference to the value associated with the key, or std::nullopt if the key is not present.
+		 * @note This function is noexcept.
+		 * @warning The returned reference is not protected by a lock once this function returns. Use Find() with an accessor if the Hashmap may be modified concurrently.
+		 */
+		optional_ref Get(const Tk& _key) const noexcept {
+
+			typename optional_ref::optional_t result = std::nullopt;
+
+			try {
+
+				const size_t hash = GetHashcode(_key);
+				const std::shared_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+
+					for (auto& kvp : bucket) {
+
+						if (GetHashcode(kvp.first) == hash) {
+							result = std::cref(kvp.second);
+							break;
+						}
+					}
+				}
+			}
+			catch (...) {}
+
+			return optional_ref(std::move(result));
+		}
+
+		/**
+		 * @brief Retrieves the value associated with the given key from the fnv1a table.
+		 *
+		 * @tparam Tk The type of the key.
+		 * @param[in] _key The key to retrieve the value for.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return An optional reference to the value associated with the key, or std::nullopt if the key is not present.
+		 * @note This function is noexcept.
+		 * @warning The returned reference is not protected by a lock once this function returns. Use Find() with an accessor if the Hashmap may be modified concurrently.
+		 */
+		optional_ref Get(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			typename optional_ref::optional_t result = std::nullopt;
+			
+			try {
+			
+				const size_t hash = GetHashcode(_key);
+				const std::shared_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+					
+					for (auto& kvp : bucket) {
+						
+						if (GetHashcode(kvp.first) == hash) {
+							result = std::cref(kvp.second);
+							break;
+						}
+					}
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return optional_ref(std::move(result));
 		}
-
+		
 		/**
-		 * @brief Queries for the existence of an item in the Hashmap.
+		 * @brief Acquires read-only access to the entry with the given key.
+		 * @details On success, the accessor holds a shared lock on the entry's stripe until it is released or destroyed.
+		 *          Any entry previously held by the accessor is released first.
 		 *
 		 * @param[in] _key Key of the entry.
-		 * @return True if successful, false otherwise.
+		 * @param[out] _accessor Accessor to attach to the entry.
+		 * @return True if the entry exists, false otherwise.
 		 */
-		bool ContainsKey(const Tk& _key) const noexcept {
-
-			const std::shared_lock lock(s_Lock);
-
+		bool Find(const Tk& _key, ConstAccessor& _accessor) const noexcept {
+			
+			_accessor.release();
+			
 			auto result = false;
-
+			
 			try {
-
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				size_t hash = GetHashcode(_key);
-				size_t i = hash % m_Buckets.size();
-
-				auto& bucket = m_Buckets[i];
-
+				
+				const size_t hash = GetHashcode(_key);
+				std::shared_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+					
+					for (auto& kvp : bucket) {
+						
+						if (GetHashcode(kvp.first) == hash) {
+							result = true;
+							
+							_accessor.m_Lock  = std::move(lock);
+							_accessor.m_Entry = &kvp;
+							
+							break;
+						}
+					}
+				}
+			}
+			catch (...) {}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Acquires read-only access to the entry with the given key.
+		 * @details On success, the accessor holds a shared lock on the entry's stripe until it is released or destroyed.
+		 *          Any entry previously held by the accessor is released first.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _accessor Accessor to attach to the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if the entry exists, false otherwise.
+		 */
+		bool Find(const Tk& _key, ConstAccessor& _accessor, std::exception_ptr& _exception) const noexcept {
+			
+			_accessor.release();
+			
+			auto result = false;
+			
+			try {
+				
+				const size_t hash = GetHashcode(_key);
+				std::shared_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+					
+					for (auto& kvp : bucket) {
+						
+						if (GetHashcode(kvp.first) == hash) {
+							result = true;
+							
+							_accessor.m_Lock  = std::move(lock);
+							_accessor.m_Entry = &kvp;
+							
+							break;
+						}
+					}
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Acquires mutable access to the entry with the given key.
+		 * @details On success, the accessor holds an exclusive lock on the entry's stripe until it is released or destroyed.
+		 *          Any entry previously held by the accessor is released first.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _accessor Accessor to attach to the entry.
+		 * @return True if the entry exists, false otherwise.
+		 */
+		bool Find(const Tk& _key, Accessor& _accessor) noexcept {
+			
+			_accessor.release();
+			
+			auto result = false;
+			
+			try {
+				
+				const size_t hash = GetHashcode(_key);
+				std::unique_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+					
+					for (auto& kvp : bucket) {
+						
+						if (GetHashcode(kvp.first) == hash) {
+							result = true;
+							
+							_accessor.m_Lock  = std::move(lock);
+							_accessor.m_Entry = &kvp;
+							
+							break;
+						}
+					}
+				}
+			}
+			catch (...) {}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Acquires mutable access to the entry with the given key.
+		 * @details On success, the accessor holds an exclusive lock on the entry's stripe until it is released or destroyed.
+		 *          Any entry previously held by the accessor is released first.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _accessor Accessor to attach to the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if the entry exists, false otherwise.
+		 */
+		bool Find(const Tk& _key, Accessor& _accessor, std::exception_ptr& _exception) noexcept {
+			
+			_accessor.release();
+			
+			auto result = false;
+			
+			try {
+				
+				const size_t hash = GetHashcode(_key);
+				std::unique_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+					
+					for (auto& kvp : bucket) {
+						
+						if (GetHashcode(kvp.first) == hash) {
+							result = true;
+							
+							_accessor.m_Lock  = std::move(lock);
+							_accessor.m_Entry = &kvp;
+							
+							break;
+						}
+					}
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Inserts a new entry if one does not already exist, and acquires mutable access to the entry with the given key.
+		 * @details On success, the accessor holds an exclusive lock on the entry's stripe until it is released or destroyed.
+		 *          Any entry previously held by the accessor is released first.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value to insert if no entry exists.
+		 * @param[out] _accessor Accessor to attach to the entry.
+		 * @return True if a new entry was inserted, false if the entry already existed or the operation failed.
+		 */
+		bool Insert(const Tk& _key, const Tv& _value, Accessor& _accessor) noexcept {
+			
+			_accessor.release();
+			
+			auto result = false;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
+				
+				KeyValuePair* entry = nullptr;
+				
 				for (auto& kvp : bucket) {
-
+					
 					if (GetHashcode(kvp.first) == hash) {
-						result = true;
-
+						entry = &kvp;
+						
 						break;
 					}
 				}
+				
+				if (entry == nullptr) {
+					bucket.emplace_back(_key, _value);
+					
+					StripeOf(hash).Adjust(1);
+					
+					entry  = &bucket.back();
+					result = true;
+				}
+				
+				_accessor.m_Lock  = std::move(lock);
+				_accessor.m_Entry = entry;
 			}
 			catch (...) {}
-
+			
 			return result;
 		}
-
+		
 		/**
-		 * @brief Queries for the existence of an item in the Hashmap.
+		 * @brief Inserts a new entry if one does not already exist, and acquires mutable access to the entry with the given key.
+		 * @details On success, the accessor holds an exclusive lock on the entry's stripe until it is released or destroyed.
+		 *          Any entry previously held by the accessor is released first.
 		 *
 		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value to insert if no entry exists.
+		 * @param[out] _accessor Accessor to attach to the entry.
 		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
-		 * @return True if successful, false otherwise.
+		 * @return True if a new entry was inserted, false if the entry already existed or the operation failed.
 		 */
-		bool ContainsKey(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+		bool Insert(const Tk& _key, const Tv& _value, Accessor& _accessor, std::exception_ptr& _exception) noexcept {
+			
+			_accessor.release();
 			
-			const std::shared_lock lock(s_Lock);
-
 			auto result = false;
 			
 			try {
 				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				size_t hash = GetHashcode(_key);
-				size_t i = hash % m_Buckets.size();
+				const auto hash = GetHashcode(_key);
+				auto lock = LockForInsert(hash);
+				
+				auto& bucket = *BucketOf(hash);
 				
-				auto& bucket = m_Buckets[i];
+				KeyValuePair* entry = nullptr;
 				
 				for (auto& kvp : bucket) {
 					
 					if (GetHashcode(kvp.first) == hash) {
-						result = true;
+						entry = &kvp;
+						
+						break;
+					}
+				}
+				
+				if (entry == nullptr) {
+					bucket.emplace_back(_key, _value);
+					
+					StripeOf(hash).Adjust(1);
+					
+					entry  = &bucket.back();
+					result = true;
+				}
+				
+				_accessor.m_Lock  = std::move(lock);
+				_accessor.m_Entry = entry;
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Removes the entry with the given key from the Hashmap, transferring ownership of it to a Node.
+		 *
+		 * @param[in] _key Key of the entry to extract.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return A Node owning the entry, or an empty Node if no entry exists or the operation failed.
+		 */
+		Node Extract(const Tk& _key, std::exception_ptr& _exception) noexcept {
+			
+			Node result;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				const std::unique_lock lock(StripeOf(hash).m_Lock);
+				
+				if (auto* target = BucketOf(hash)) {
+					
+					auto& bucket = *target;
+					
+					for (auto itr = bucket.begin(); itr < bucket.end(); itr++) {
+						
+						if (GetHashcode(itr->first) == hash) {
+							
+							if constexpr (s_Nodes) {
+								result.m_Entry = std::move(*itr.m_Itr);
+							}
+							else {
+								result.m_Entry.emplace(std::move(*itr));
+							}
+							
+							bucket.erase(itr);
+							
+							StripeOf(hash).Adjust(-1);
+							
+							break;
+						}
+					}
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Extract(const Tk&, std::exception_ptr&) */
+		Node Extract(const Tk& _key) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Extract(_key, exception);
+		}
+		
+		/**
+		 * @brief Inserts the entry owned by a Node, if no entry with the same key exists.
+		 * @details On success the Node is left empty. Otherwise, the Node retains ownership of the entry.
+		 *
+		 * @param[in,out] _node Node owning the entry to insert.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if the entry was inserted, false otherwise.
+		 */
+		bool Insert(Node&& _node, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				if (!_node.empty()) {
+					
+					const auto hash = GetHashcode(_node.key());
+					const auto lock = LockForInsert(hash);
+					
+					auto& bucket = *BucketOf(hash);
+					
+					result = true;
+					
+					for (auto& kvp : bucket) {
+						
+						if (GetHashcode(kvp.first) == hash) {
+							result = false;
+							
+							break;
+						}
+					}
+					
+					if (result) {
+						
+						if constexpr (s_Nodes) {
+							bucket.m_Nodes.emplace_back(std::move(_node.m_Entry));
+						}
+						else {
+							bucket.emplace_back(std::move(*_node.m_Entry));
+						}
+						
+						StripeOf(hash).Adjust(1);
 						
-						break;
+						_node.m_Entry.reset();
 					}
 				}
 			}
@@ -352,197 +3475,399 @@ namespace LouiEriksson {
 			
 			return result;
 		}
-
+		
+		/** @copydoc Insert(Node&&, std::exception_ptr&) */
+		bool Insert(Node&& _node) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Insert(std::move(_node), exception);
+		}
+		
 		/**
-		 * @brief Inserts a new entry into the Hashmap with given key and value, if one does not already exist.
-		 * If you are trying to modify an existing key, see Hashmap::Assign.
+		 * @brief Moves every entry of another Hashmap whose key does not exist within this Hashmap into this Hashmap, without copying keys or values.
+		 * @details Entries whose key already exists remain in the other Hashmap. The capacity of this Hashmap is increased at most once beforehand.
+		 *          Every stripe of both Hashmaps is held for the duration of the merge.
 		 *
-		 * @param[in] _key Key of the entry.
-		 * @param[in] _value Value of the entry.
-		 * @return True if successful, false otherwise.
+		 * @param[in,out] _other The Hashmap to merge from.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
 		 */
-		bool Add(const Tk& _key, const Tv& _value) noexcept {
-
-			const std::unique_lock lock(s_Lock);
-
-			auto result = true;
-
+		void Merge(Hashmap& _other, std::exception_ptr& _exception) noexcept {
+			
 			try {
-
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2U);
-				}
-
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
-
-				auto& bucket = m_Buckets[i];
-
-				// In the case of a hash collision, determine if the key is unique.
-				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
-				for (auto& kvp : bucket) {
-					if (GetHashcode(kvp.first) == hash) {
-						result = false;
-
-						break;
+				
+				if (this != &_other) {
+					
+					// Acquire the Hashmaps in a consistent order, so that concurrent merges in opposite directions cannot deadlock.
+					auto& first  = std::less<const Hashmap*>()(this, &_other) ? *this : _other;
+					auto& second = &first == this ? _other : *this;
+					
+					const auto firstLock  =  first.template LockAll<std::unique_lock<Mutex>>();
+					const auto secondLock = second.template LockAll<std::unique_lock<Mutex>>();
+					
+					       Finish();
+					_other.Finish();
+					
+					const auto required = Count() + _other.Count();
+					
+					if (m_Buckets.size() < required) {
+						Resize(required);
+					}
+					
+					for (auto& bucket : _other.m_Buckets) {
+						
+						// Entries which remain in the other Hashmap are compacted towards the front of the bucket.
+						auto keep = bucket.begin();
+						auto itr  = bucket.begin();
+						
+						try {
+							
+							for (; itr != bucket.end(); ++itr) {
+								
+								const auto hash = GetHashcode(itr->first);
+								
+								auto& target = *BucketOf(hash);
+								
+								auto exists = false;
+								
+								for (const auto& kvp : target) {
+									
+									if (GetHashcode(kvp.first) == hash) {
+										exists = true;
+										
+										break;
+									}
+								}
+								
+								if (exists) {
+									
+									if (keep != itr) {
+										Shift(keep, itr);
+									}
+									
+									++keep;
+								}
+								else {
+									Transfer(target, itr);
+									
+									       StripeOf(hash).Adjust( 1);
+									_other.StripeOf(hash).Adjust(-1);
+								}
+							}
+						}
+						catch (...) {
+							
+							// Discard the entries which were moved from, leaving every remaining entry intact.
+							bucket.erase(keep, itr);
+							
+							throw;
+						}
+						
+						bucket.erase(keep, bucket.end());
 					}
-				}
-
-				// Insert the item into the bucket.
-				if (result) {
-					m_Size++;
-
-					bucket.emplace_back(_key, _value);
 				}
 			}
-			catch (...) {}
-
-			return result;
+			catch (...) {
+				_exception = std::current_exception();
+			}
 		}
-
+		
+		/** @copydoc Merge(Hashmap&, std::exception_ptr&) */
+		void Merge(Hashmap& _other) noexcept {
+			
+			std::exception_ptr exception;
+			
+			Merge(_other, exception);
+		}
+		
 		/**
-		 * @brief Inserts a new entry into the Hashmap with given key and value, if one does not already exist.
-		 * If you are trying to modify an existing key, see Hashmap::Assign.
+		 * @brief Moves every entry of a collection of Hashmaps into this Hashmap, such as when combining the partial results of several threads.
+		 * @details The capacity of this Hashmap is increased at most once beforehand, and no key or value is copied.
+		 *          Entries are distributed between threads by the range of buckets they are destined for, so each thread inserts into its own buckets.
+		 *          When a key exists in more than one place, the resolver is invoked with the existing value and the incoming value, in the order of the sources.
+		 *          Every stripe of this Hashmap is held for the duration of the merge. The sources are left empty, even if the merge fails.
 		 *
-		 * @param[in] _key Key of the entry.
-		 * @param[in] _value Value of the entry.
+		 * @tparam Tf Callable type with the signature void(Tv& _existing, Tv&& _incoming). Must be safe to invoke concurrently for different keys.
+		 * @param[in] _sources The Hashmaps to merge from.
+		 * @param[in] _resolve Callable resolving an entry whose key already exists.
 		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
-		 * @return True if successful, false otherwise.
 		 */
-		bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
-			
-			const std::unique_lock lock(s_Lock);
-			
-			auto result = true;
+		template<typename Tf>
+		void MergeFrom(std::vector<Hashmap>&& _sources, Tf&& _resolve, std::exception_ptr& _exception) noexcept {
 			
 			try {
 				
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2U);
+				const auto lock = LockAll<std::unique_lock<Mutex>>();
+				
+				Finish();
+				
+				std::vector<std::array<std::unique_lock<Mutex>, TPolicy::Stripes>> locks;
+				locks.reserve(_sources.size());
+				
+				auto required = Count();
+				
+				for (auto& source : _sources) {
+					
+					locks.emplace_back(source.template LockAll<std::unique_lock<Mutex>>());
+					
+					source.Finish();
+					
+					required += source.Count();
 				}
 				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
+				std::exception_ptr failure;
 				
-				auto& bucket = m_Buckets[i];
+				std::vector<std::array<size_t, TPolicy::Stripes>> added;
 				
-				// In the case of a hash collision, determine if the key is unique.
-				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
-				for (auto& kvp : bucket) {
-					if (GetHashcode(kvp.first) == hash) {
-						result = false;
+				try {
+					
+					if (m_Buckets.size() < required) {
+						Resize(required);
+					}
+					
+					std::vector<bucket_t*> inputs;
+					
+					for (auto& source : _sources) {
+						for (auto& bucket : source.m_Buckets) {
+							
+							if (!bucket.empty()) {
+								inputs.emplace_back(&bucket);
+							}
+						}
+					}
+					
+					static constexpr size_t s_EntriesPerWorker = 16384U;
+					
+					const auto workers = std::clamp<size_t>((required - Count()) / s_EntriesPerWorker, 1U, std::max(std::thread::hardware_concurrency(), 1U));
+					const auto span    = (m_Buckets.size() + workers - 1U) / workers;
+					
+					struct Item final {
+						typename bucket_t::iterator m_Entry;
+						size_t m_Hash;
+					};
+					
+					// Outboxes of each worker, grouped by the worker whose range of buckets each entry is destined for.
+					std::vector<std::vector<std::vector<Item>>> outboxes(workers, std::vector<std::vector<Item>>(workers));
+					
+					added.resize(workers);
+					
+					// Each worker hashes a contiguous share of the sources' buckets, preserving the order of the sources across workers.
+					Parallel(workers, [&](const size_t& _worker) {
 						
-						break;
+						const auto first = (inputs.size() *  _worker      ) / workers;
+						const auto last  = (inputs.size() * (_worker + 1U)) / workers;
+						
+						for (auto i = first; i < last; ++i) {
+							for (auto itr = inputs[i]->begin(); itr != inputs[i]->end(); ++itr) {
+								
+								const auto hash = GetHashcode(itr->first);
+								
+								outboxes[_worker][(Spread(hash) % m_Buckets.size()) / span].push_back({ itr, hash });
+							}
+						}
+					});
+					
+					Parallel(workers, [&](const size_t& _worker) {
+						
+						for (const auto& outbox : outboxes) {
+							for (const auto& item : outbox[_worker]) {
+								
+								auto& bucket = m_Buckets[Spread(item.m_Hash) % m_Buckets.size()];
+								
+								KeyValuePair* existing = nullptr;
+								
+								for (auto& kvp : bucket) {
+									
+									if (GetHashcode(kvp.first) == item.m_Hash) {
+										existing = &kvp;
+										
+										break;
+									}
+								}
+								
+								if (existing != nullptr) {
+									_resolve(existing->second, std::move(item.m_Entry->second));
+								}
+								else {
+									Transfer(bucket, item.m_Entry);
+									
+									added[_worker][Spread(item.m_Hash) % TPolicy::Stripes]++;
+								}
+							}
+						}
+					});
+				}
+				catch (...) {
+					failure = std::current_exception();
+				}
+				
+				for (const auto& counts : added) {
+					for (size_t i = 0U; i < TPolicy::Stripes; ++i) {
+						m_Stripes[i].Adjust(static_cast<std::ptrdiff_t>(counts[i]));
 					}
 				}
 				
-				// Insert the item into the bucket.
-				if (result) {
-					m_Size++;
+				for (auto& source : _sources) {
 					
-					bucket.emplace_back(_key, _value);
+					source.m_Buckets.clear();
+					
+					for (auto& stripe : source.m_Stripes) {
+						stripe.m_Size.store(0U, std::memory_order_relaxed);
+					}
+				}
+				
+				if (failure) {
+					std::rethrow_exception(failure);
 				}
 			}
 			catch (...) {
 				_exception = std::current_exception();
 			}
+		}
+		
+		/** @copydoc MergeFrom(std::vector<Hashmap>&&, Tf&&, std::exception_ptr&) */
+		template<typename Tf>
+		void MergeFrom(std::vector<Hashmap>&& _sources, Tf&& _resolve) noexcept {
 			
-			return result;
+			std::exception_ptr exception;
+			
+			MergeFrom(std::move(_sources), std::forward<Tf>(_resolve), exception);
 		}
-
+		
 		/**
-		 * @brief Inserts a new entry into the Hashmap with given key and value using move semantics, if one does not already exist.
-		 * If you are trying to modify an existing key, see Hashmap::Assign.
+		 * @brief Moves every entry of a collection of Hashmaps into this Hashmap, resolving duplicate keys by a fixed policy.
+		 * @details The policy is taken by value, so that this overload is preferred over the overload accepting a callable.
 		 *
-		 * @param[in] _key Key of the entry.
-		 * @param[in] _value Value of the entry.
-		 * @return True if successful, false otherwise.
+		 * @param[in] _sources The Hashmaps to merge from.
+		 * @param[in] _conflict Whether an existing value is kept or replaced by an incoming one.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @see MergeFrom(std::vector<Hashmap>&&, Tf&&, std::exception_ptr&)
 		 */
-		bool Add(const Tk&& _key, const Tv&& _value) noexcept {
-
-			const std::unique_lock lock(s_Lock);
-
-			auto result = true;
-
-			try {
-
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2U);
-				}
-
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
-
-				auto& bucket = m_Buckets[i];
-
-				// In the case of a hash collision, determine if the key is unique.
-				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
-				for (auto& kvp : bucket) {
-					if (GetHashcode(kvp.first) == hash) {
-						result = false;
-
-						break;
-					}
-				}
-
-				// Insert the item into the bucket.
-				if (result) {
-					m_Size++;
-
-					bucket.emplace_back(_key, _value);
-				}
+		void MergeFrom(std::vector<Hashmap>&& _sources, MergeConflict _conflict, std::exception_ptr& _exception) noexcept {
+			
+			if (_conflict == MergeConflict::Replace) {
+				MergeFrom(std::move(_sources), [](Tv& _existing, Tv&& _incoming) { _existing = std::move(_incoming); }, _exception);
+			}
+			else {
+				MergeFrom(std::move(_sources), [](Tv&, Tv&&) {}, _exception);
 			}
-			catch (...) {}
-
-			return result;
 		}
-
+		
+		/** @copydoc MergeFrom(std::vector<Hashmap>&&, MergeConflict, std::exception_ptr&) */
+		void MergeFrom(std::vector<Hashmap>&& _sources, MergeConflict _conflict) noexcept {
+			
+			std::exception_ptr exception;
+			
+			MergeFrom(std::move(_sources), _conflict, exception);
+		}
+		
 		/**
-		 * @brief Inserts a new entry into the Hashmap with given key and value using move semantics, if one does not already exist.
-		 * If you are trying to modify an existing key, see Hashmap::Assign.
+		 * @brief Acquires every stripe exclusively, returning a view through which a sequence of operations can be performed atomically.
+		 * @details For example, moving a value from one key to another:
 		 *
-		 * @param[in] _key Key of the entry.
-		 * @param[in] _value Value of the entry.
+		 * @code
+		 * {
+		 *     auto transaction = hashmap.Transaction();
+		 *
+		 *     if (const auto value = transaction.Get(from)) {
+		 *         transaction.Assign(to, *value);
+		 *         transaction.Remove(from);
+		 *     }
+		 * }
+		 * @endcode
+		 *
+		 * @return A view holding every stripe until it is destroyed.
+		 */
+		[[nodiscard]] View Transaction() {
+			return View(*this);
+		}
+		
+		/**
+		 * @brief Acquires every stripe in shared mode, returning a view through which a consistent state of the Hashmap can be read.
+		 * @return A view holding every stripe until it is destroyed.
+		 */
+		[[nodiscard]] ReadView ReadTransaction() const {
+			return ReadView(*this);
+		}
+		
+		/**
+		 * @brief Writes every entry of the Hashmap to a stream in a versioned binary format.
+		 * @details Every stripe is held in shared mode while writing, so the entries written reflect a single consistent state of the Hashmap.
+		 *          If both codecs are raw, entries are written in bulk as their object representation.
+		 *
+		 * @tparam TKeyCodec Codec of the keys. See BinaryCodec.
+		 * @tparam TValueCodec Codec of the values. See BinaryCodec.
+		 * @param[in,out] _stream Stream to write to, opened in binary mode.
 		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
-		 * @return True if successful, false otherwise.
+		 * @return True if every entry was written, false otherwise.
 		 */
-		bool Add(const Tk&& _key, const Tv&& _value, std::exception_ptr& _exception) noexcept {
+		template<typename TKeyCodec = BinaryCodec<Tk>, typename TValueCodec = BinaryCodec<Tv>>
+		bool SaveBinary(std::ostream& _stream, std::exception_ptr& _exception) const noexcept {
 			
-			const std::unique_lock lock(s_Lock);
-			
-			auto result = true;
+			auto result = false;
 			
 			try {
 				
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2U);
-				}
+				const auto lock = LockAll<std::shared_lock<Mutex>>();
 				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
+				constexpr auto raw = s_Raw<TKeyCodec, TValueCodec>;
 				
-				auto& bucket = m_Buckets[i];
+				const std::array<uint32_t, 4U> header {
+					s_BinaryMagic,
+					s_BinaryVersion,
+					static_cast<uint32_t>(raw ? sizeof(Tk) : 0U),
+					static_cast<uint32_t>(raw ? sizeof(Tv) : 0U)
+				};
 				
-				// In the case of a hash collision, determine if the key is unique.
-				// We will treat duplicate insertions as a mistake on the developer's part and return failure.
-				for (auto& kvp : bucket) {
-					if (GetHashcode(kvp.first) == hash) {
-						result = false;
+				const auto count = static_cast<uint64_t>(Count());
+				
+				_stream.write(reinterpret_cast<const char*>(header.data()), sizeof(header));
+				_stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+				
+				if constexpr (raw) {
+					
+					constexpr auto stride = sizeof(Tk) + sizeof(Tv);
+					
+					std::vector<char> buffer;
+					buffer.reserve(s_BinaryBatch * stride);
+					
+					ForEachBucket([&_stream, &buffer](const bucket_t& _bucket) {
 						
-						break;
-					}
+						for (const auto& kvp : _bucket) {
+							
+							const auto offset = buffer.size();
+							
+							buffer.resize(offset + stride);
+							
+							std::memcpy(&buffer[offset],               &kvp.first,  sizeof(Tk));
+							std::memcpy(&buffer[offset + sizeof(Tk)], &kvp.second, sizeof(Tv));
+							
+							if (buffer.size() == buffer.capacity()) {
+								_stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+								
+								buffer.clear();
+							}
+						}
+					});
+					
+					_stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 				}
-				
-				// Insert the item into the bucket.
-				if (result) {
-					m_Size++;
+				else {
 					
-					bucket.emplace_back(_key, _value);
+					ForEachBucket([&_stream](const bucket_t& _bucket) {
+						
+						for (const auto& kvp : _bucket) {
+							TKeyCodec::Write(_stream, kvp.first);
+							TValueCodec::Write(_stream, kvp.second);
+						}
+					});
+				}
+				
+				if (!_stream) {
+					throw std::runtime_error("Failed to write the Hashmap to the stream.");
 				}
+				
+				result = true;
 			}
 			catch (...) {
 				_exception = std::current_exception();
@@ -550,260 +3875,395 @@ namespace LouiEriksson {
 			
 			return result;
 		}
-
-		/**
-		 * @brief Inserts or replaces an entry within the Hashmap with the given key.
-		 *
-		 * @param[in] _key Key of the entry.
-		 * @param[in] _value Value of the entry.
-		 */
-		void Assign(const Tk& _key, const Tv& _value) noexcept {
-
-			const std::unique_lock lock(s_Lock);
-
-			try {
-
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2U);
-				}
-
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
-
-				auto& bucket = m_Buckets[i];
-
-				auto exists = false;
-				for (auto& kvp : bucket) {
-
-					if (GetHashcode(kvp.first) == hash) {
-						exists = true;
-
-						kvp.second = _value;
-
-						break;
-					}
-				}
-
-				if (!exists) {
-					m_Size++;
-
-					bucket.emplace_back(_key, _value);
-				}
-			}
-			catch (...) {}
+		
+		/** @copydoc SaveBinary(std::ostream&, std::exception_ptr&) const */
+		template<typename TKeyCodec = BinaryCodec<Tk>, typename TValueCodec = BinaryCodec<Tv>>
+		bool SaveBinary(std::ostream& _stream) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return SaveBinary<TKeyCodec, TValueCodec>(_stream, exception);
 		}
-
+		
 		/**
-		 * @brief Inserts or replaces an entry within the Hashmap with the given key.
+		 * @brief Writes every entry of the Hashmap to a file in a versioned binary format, replacing the file if it exists.
 		 *
-		 * @param[in] _key Key of the entry.
-		 * @param[in] _value Value of the entry.
+		 * @tparam TKeyCodec Codec of the keys. See BinaryCodec.
+		 * @tparam TValueCodec Codec of the values. See BinaryCodec.
+		 * @param[in] _path Path of the file.
 		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if every entry was written, false otherwise.
+		 * @see SaveBinary(std::ostream&, std::exception_ptr&) const
 		 */
-		void Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+		template<typename TKeyCodec = BinaryCodec<Tk>, typename TValueCodec = BinaryCodec<Tv>>
+		bool SaveBinary(const std::string& _path, std::exception_ptr& _exception) const noexcept {
 			
-			const std::unique_lock lock(s_Lock);
+			auto result = false;
 			
 			try {
 				
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2U);
-				}
-				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
+				std::ofstream stream(_path, std::ios::binary | std::ios::trunc);
 				
-				auto& bucket = m_Buckets[i];
+				if (!stream) {
+					throw std::runtime_error("Failed to open \"" + _path + "\" for writing.");
+				}
 				
-				auto exists = false;
-				for (auto& kvp : bucket) {
+				if (SaveBinary<TKeyCodec, TValueCodec>(stream, _exception)) {
 					
-					if (GetHashcode(kvp.first) == hash) {
-						exists = true;
-						
-						kvp.second = _value;
-						
-						break;
+					stream.close();
+					
+					if (!stream) {
+						throw std::runtime_error("Failed to write \"" + _path + "\".");
 					}
-				}
-				
-				if (!exists) {
-					m_Size++;
 					
-					bucket.emplace_back(_key, _value);
+					result = true;
 				}
 			}
 			catch (...) {
 				_exception = std::current_exception();
 			}
+			
+			return result;
 		}
-
-		/**
-		 * @brief Inserts or replaces an entry within the Hashmap with the given key using move semantics.
-		 *
-		 * @param[in] _key Key of the entry.
-		 * @param[in] _value Value of the entry.
-		 */
-		void Assign(Tk&& _key, Tv&& _value) noexcept {
-
-			const std::unique_lock lock(s_Lock);
-
-			try {
-
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2U);
-				}
-
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
-
-				auto& bucket = m_Buckets[i];
-
-				auto exists = false;
-				for (auto& kvp : bucket) {
-
-					if (GetHashcode(kvp.first) == hash) {
-						exists = true;
-
-						kvp.second = std::move(_value);
-
-						break;
-					}
-				}
-
-				if (!exists) {
-					m_Size++;
-
-					bucket.emplace_back(std::move(_key), std::move(_value));
-				}
-			}
-			catch (...) {}
+		
+		/** @copydoc SaveBinary(const std::string&, std::exception_ptr&) const */
+		template<typename TKeyCodec = BinaryCodec<Tk>, typename TValueCodec = BinaryCodec<Tv>>
+		bool SaveBinary(const std::string& _path) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return SaveBinary<TKeyCodec, TValueCodec>(_path, exception);
 		}
-
+		
 		/**
-		 * @brief Inserts or replaces an entry within the Hashmap with the given key using move semantics.
+		 * @brief Replaces the contents of the Hashmap with the entries read from a stream written by SaveBinary.
+		 * @details The entries are decoded into a new table, sized from the count in the header so that loading never resizes,
+		 *          without acquiring any lock. The stripes are only acquired to swap the new table in.
+		 *          The codecs must match those the stream was written with. If an exception is thrown, the Hashmap is left unchanged.
 		 *
-		 * @param[in] _key Key of the entry.
-		 * @param[in] _value Value of the entry.
+		 * @tparam TKeyCodec Codec of the keys. See BinaryCodec.
+		 * @tparam TValueCodec Codec of the values. See BinaryCodec.
+		 * @param[in,out] _stream Stream to read from, opened in binary mode.
 		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if every entry was read, false otherwise.
 		 */
-		void Assign(Tk&& _key, Tv&& _value, std::exception_ptr& _exception) noexcept {
+		template<typename TKeyCodec = BinaryCodec<Tk>, typename TValueCodec = BinaryCodec<Tv>>
+		bool LoadBinary(std::istream& _stream, std::exception_ptr& _exception) noexcept {
 			
-			const std::unique_lock lock(s_Lock);
+			auto result = false;
 			
 			try {
 				
-				if (m_Size >= m_Buckets.size()) {
-					Resize(m_Buckets.size() * 2U);
+				constexpr auto raw = s_Raw<TKeyCodec, TValueCodec>;
+				
+				std::array<uint32_t, 4U> header {};
+				uint64_t count = 0U;
+				
+				_stream.read(reinterpret_cast<char*>(header.data()), sizeof(header));
+				_stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+				
+				if (!_stream || header[0U] != s_BinaryMagic) {
+					throw std::runtime_error("The stream does not contain a Hashmap.");
 				}
 				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const auto hash = GetHashcode(_key);
-				const auto i = hash % m_Buckets.size();
+				if (header[1U] != s_BinaryVersion) {
+					throw std::runtime_error("The stream contains an unsupported version of the Hashmap format.");
+				}
 				
-				auto& bucket = m_Buckets[i];
+				if (header[2U] != (raw ? sizeof(Tk) : 0U) || header[3U] != (raw ? sizeof(Tv) : 0U)) {
+					throw std::runtime_error("The stream was written with different codecs.");
+				}
 				
-				auto exists = false;
-				for (auto& kvp : bucket) {
+				// Size the table from the header, but never for more entries than the rest of the stream can hold (or, if its length is unknown,
+				// for more than a batch), so that a corrupt count cannot allocate more memory than the entries actually read.
+				auto reserved = count;
+				
+				if (const auto remaining = Remaining(_stream)) {
+					reserved = std::min<uint64_t>(reserved, *remaining / (raw ? sizeof(Tk) + sizeof(Tv) : 1U));
+				}
+				else {
+					reserved = std::min<uint64_t>(reserved, s_BinaryBatch);
+				}
+				
+				std::vector<bucket_t> buckets(Align(static_cast<size_t>(reserved)));
+				
+				std::array<size_t, TPolicy::Stripes> sizes {};
+				
+				size_t total = 0U;
+				
+				const auto place = [&buckets, &sizes, &total](Tk&& _key, Tv&& _value) {
 					
-					if (GetHashcode(kvp.first) == hash) {
-						exists = true;
+					const auto hash = GetHashcode(_key);
+					
+					auto& bucket = buckets[Spread(hash) % buckets.size()];
+					
+					auto exists = false;
+					
+					// Files written by SaveBinary contain each key once, but a later duplicate replaces an earlier one rather than being stored twice.
+					for (auto& kvp : bucket) {
 						
-						kvp.second = std::move(_value);
+						if (GetHashcode(kvp.first) == hash) {
+							kvp.second = std::move(_value);
+							
+							exists = true;
+							
+							break;
+						}
+					}
+					
+					if (!exists) {
+						bucket.emplace_back(std::move(_key), std::move(_value));
 						
-						break;
+						++sizes[Spread(hash) % TPolicy::Stripes];
+						
+						// Grow the table if the stream holds more entries than it was sized for.
+						if (++total > buckets.size()) {
+							
+							std::vector<bucket_t> grown(Align(buckets.size() * 2U));
+							
+							for (auto& source : buckets) {
+								for (auto itr = source.begin(); itr != source.end(); ++itr) {
+									Transfer(grown[Spread(GetHashcode(itr->first)) % grown.size()], itr);
+								}
+							}
+							
+							buckets = std::move(grown);
+						}
+					}
+				};
+				
+				if constexpr (raw) {
+					
+					constexpr auto stride = sizeof(Tk) + sizeof(Tv);
+					
+					std::vector<char> buffer(s_BinaryBatch * stride);
+					
+					for (uint64_t read = 0U; read < count;) {
+						
+						const auto batch = static_cast<size_t>(std::min<uint64_t>(count - read, s_BinaryBatch));
+						
+						if (!_stream.read(buffer.data(), static_cast<std::streamsize>(batch * stride))) {
+							break;
+						}
+						
+						for (size_t i = 0U; i < batch; ++i) {
+							
+							Tk key;
+							Tv value;
+							
+							std::memcpy(&key,   &buffer[i * stride],               sizeof(Tk));
+							std::memcpy(&value, &buffer[i * stride + sizeof(Tk)], sizeof(Tv));
+							
+							place(std::move(key), std::move(value));
+						}
+						
+						read += batch;
+					}
+				}
+				else {
+					
+					for (uint64_t i = 0U; i < count && _stream; ++i) {
+						
+						auto key   =   TKeyCodec::Read(_stream);
+						auto value = TValueCodec::Read(_stream);
+						
+						if (_stream) {
+							place(std::move(key), std::move(value));
+						}
 					}
 				}
 				
-				if (!exists) {
-					m_Size++;
+				if (!_stream) {
+					throw std::runtime_error("The stream ended before every entry of the Hashmap was read.");
+				}
+				
+				{
+					const auto lock = LockAll<std::unique_lock<Mutex>>();
 					
-					bucket.emplace_back(std::move(_key), std::move(_value));
+					// The previous table is destroyed once the stripes have been released.
+					m_Buckets.swap(buckets);
+					
+					Abandon();
+					Detach();
+					
+					for (size_t i = 0U; i < TPolicy::Stripes; ++i) {
+						m_Stripes[i].m_Size.store(sizes[i], std::memory_order_relaxed);
+					}
 				}
+				
+				result = true;
 			}
 			catch (...) {
 				_exception = std::current_exception();
 			}
+			
+			return result;
 		}
-
+		
+		/** @copydoc LoadBinary(std::istream&, std::exception_ptr&) */
+		template<typename TKeyCodec = BinaryCodec<Tk>, typename TValueCodec = BinaryCodec<Tv>>
+		bool LoadBinary(std::istream& _stream) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return LoadBinary<TKeyCodec, TValueCodec>(_stream, exception);
+		}
+		
 		/**
-		 * @brief Removes entry with given key from the Hashmap.
+		 * @brief Replaces the contents of the Hashmap with the entries read from a file written by SaveBinary.
 		 *
-		 * @param[in] _key Key of the entry to be removed.
-		 * @return True if successful, false otherwise.
+		 * @tparam TKeyCodec Codec of the keys. See BinaryCodec.
+		 * @tparam TValueCodec Codec of the values. See BinaryCodec.
+		 * @param[in] _path Path of the file.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if every entry was read, false otherwise.
+		 * @see LoadBinary(std::istream&, std::exception_ptr&)
 		 */
-		bool Remove(const Tk& _key) noexcept {
-
-			const std::unique_lock lock(s_Lock);
-
-			bool result = false;
-
+		template<typename TKeyCodec = BinaryCodec<Tk>, typename TValueCodec = BinaryCodec<Tv>>
+		bool LoadBinary(const std::string& _path, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
 			try {
-
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const size_t hash = GetHashcode(_key);
-				const size_t i = hash % m_Buckets.size();
-
-				auto& bucket = m_Buckets[i];
-
-				// In the case of accessing a "collided" hash, find the value in the bucket using equality checks.
-				for (auto itr = bucket.begin(); itr < bucket.end(); itr++) {
-
-					if (GetHashcode(itr->first) == hash) {
-						result = true;
-
-						bucket.erase(itr);
-
-						break;
-					}
+				
+				std::ifstream stream(_path, std::ios::binary);
+				
+				if (!stream) {
+					throw std::runtime_error("Failed to open \"" + _path + "\" for reading.");
 				}
-
-				m_Size -= static_cast<size_t>(result);
-
+				
+				result = LoadBinary<TKeyCodec, TValueCodec>(stream, _exception);
 			}
-			catch (...) {}
-
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
 			return result;
 		}
-
+		
+		/** @copydoc LoadBinary(const std::string&, std::exception_ptr&) */
+		template<typename TKeyCodec = BinaryCodec<Tk>, typename TValueCodec = BinaryCodec<Tv>>
+		bool LoadBinary(const std::string& _path) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return LoadBinary<TKeyCodec, TValueCodec>(_path, exception);
+		}
+		
 		/**
-		 * @brief Removes entry with given key from the Hashmap.
+		 * @brief Writes the Hashmap to a stream in a read-only format which can be queried in place, without deserialisation.
+		 * @details Keys and values must be trivially copyable (with an alignment of at most 8 bytes) or std::string.
+		 *          The output is position-independent, so a file containing it can be mapped into memory by any number of processes
+		 *          and read through FrozenHashmap (see FrozenHashmap.hpp) in O(1) time regardless of its size. See FrozenLayout.
 		 *
-		 * @param[in] _key Key of the entry to be removed.
+		 * @param[in,out] _stream Stream to write to, opened in binary mode.
 		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
-		 * @return True if successful, false otherwise.
+		 * @return True if the Hashmap was written, false otherwise.
 		 */
-		bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+		bool Freeze(std::ostream& _stream, std::exception_ptr& _exception) const noexcept {
 			
-			const std::unique_lock lock(s_Lock);
+			static_assert(FrozenLayout::s_Supported<Tk> && FrozenLayout::s_Supported<Tv>, "Only trivially-copyable and string keys and values can be frozen.");
 			
-			bool result = false;
+			auto result = false;
 			
 			try {
 				
-				// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-				const size_t hash = GetHashcode(_key);
-				const size_t i = hash % m_Buckets.size();
+				const auto lock = LockAll<std::shared_lock<Mutex>>();
 				
-				auto& bucket = m_Buckets[i];
+				std::vector<std::pair<size_t, const KeyValuePair*>> entries;
+				entries.reserve(Count());
 				
-				// In the case of accessing a "collided" hash, find the value in the bucket using equality checks.
-				for (auto itr = bucket.begin(); itr < bucket.end(); itr++) {
+				ForEachBucket([&entries](const bucket_t& _bucket) {
 					
-					if (GetHashcode(itr->first) == hash) {
-						result = true;
+					for (const auto& kvp : _bucket) {
+						entries.emplace_back(GetHashcode(kvp.first), &kvp);
+					}
+				});
+				
+				FrozenLayout::Header header {};
+				header.m_Magic     = FrozenLayout::s_Magic;
+				header.m_Version   = FrozenLayout::s_Version;
+				header.m_KeySize   = FrozenLayout::SizeOf<Tk>();
+				header.m_ValueSize = FrozenLayout::SizeOf<Tv>();
+				header.m_HashSize  = static_cast<uint32_t>(sizeof(size_t));
+				header.m_Probe     = FrozenLayout::ProbeOf<Tk>();
+				header.m_Count     = entries.size();
+				header.m_Buckets   = std::max<size_t>(entries.size(), 1U);
+				
+				// Group the entries by bucket with a counting sort, recording where each bucket begins.
+				std::vector<uint64_t> buckets(header.m_Buckets + 1U, 0U);
+				
+				for (const auto& entry : entries) {
+					++buckets[entry.first % header.m_Buckets + 1U];
+				}
+				
+				for (size_t i = 1U; i < buckets.size(); ++i) {
+					buckets[i] += buckets[i - 1U];
+				}
+				
+				std::vector<const std::pair<size_t, const KeyValuePair*>*> ordered(entries.size());
+				
+				{
+					auto next = buckets;
+					
+					for (const auto& entry : entries) {
+						ordered[next[entry.first % header.m_Buckets]++] = &entry;
+					}
+				}
+				
+				constexpr auto stride = FrozenLayout::EntryOf<Tk, Tv>();
+				
+				header.m_Entries = sizeof(header) + (buckets.size() * sizeof(uint64_t));
+				header.m_Data    = header.m_Entries + (entries.size() * stride);
+				
+				const auto encode = [&header](const auto& _item, char* _slot) {
+					
+					if constexpr (std::is_same_v<std::decay_t<decltype(_item)>, std::string>) {
 						
-						bucket.erase(itr);
+						const std::array<uint64_t, 2U> span { header.m_DataSize, _item.size() };
 						
-						break;
+						std::memcpy(_slot, span.data(), sizeof(span));
+						
+						header.m_DataSize += _item.size();
+					}
+					else {
+						std::memcpy(_slot, &_item, sizeof(_item));
+					}
+				};
+				
+				// Encode the entries first, as the size of the data section is not known until every string has been placed.
+				std::vector<char> encoded(entries.size() * stride, 0);
+				
+				for (size_t i = 0U; i < ordered.size(); ++i) {
+					
+					auto* slot = &encoded[i * stride];
+					
+					std::memcpy(slot, &ordered[i]->first, sizeof(uint64_t));
+					
+					encode(ordered[i]->second->first,  slot + sizeof(uint64_t));
+					encode(ordered[i]->second->second, slot + sizeof(uint64_t) + FrozenLayout::SlotOf<Tk>());
+				}
+				
+				_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				_stream.write(reinterpret_cast<const char*>(buckets.data()), static_cast<std::streamsize>(buckets.size() * sizeof(uint64_t)));
+				_stream.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+				
+				for (const auto* entry : ordered) {
+					
+					if constexpr (std::is_same_v<Tk, std::string>) {
+						_stream.write(entry->second->first.data(), static_cast<std::streamsize>(entry->second->first.size()));
+					}
+					
+					if constexpr (std::is_same_v<Tv, std::string>) {
+						_stream.write(entry->second->second.data(), static_cast<std::streamsize>(entry->second->second.size()));
 					}
 				}
 				
-				m_Size -= static_cast<size_t>(result);
+				if (!_stream) {
+					throw std::runtime_error("Failed to write the frozen Hashmap to the stream.");
+				}
 				
+				result = true;
 			}
 			catch (...) {
 				_exception = std::current_exception();
@@ -811,103 +4271,72 @@ namespace LouiEriksson {
 			
 			return result;
 		}
-
-		/**
-		 * @brief Retrieves the value associated with the given key from the fnv1a table.
-		 *
-		 * @tparam Tk The type of the key.
-		 * @param[in] _key The key to retrieve the value for.
-		 * @return An optional reference to the value associated with the key, or std::nullopt if the key is not present.
-		 * @note This function is noexcept.
-		 */
-		optional_ref Get(const Tk& _key) const noexcept {
-
-			const std::shared_lock lock(s_Lock);
-
-			typename optional_ref::optional_t result = std::nullopt;
-
-			try {
-
-				if (!m_Buckets.empty()) {
-
-					// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-					size_t hash = GetHashcode(_key);
-					size_t i = hash % m_Buckets.size();
-
-					auto& bucket = m_Buckets[i];
-
-					for (auto& kvp : bucket) {
-
-						if (GetHashcode(kvp.first) == hash) {
-							result = std::cref(kvp.second);
-							break;
-						}
-					}
-				}
-			}
-			catch (...) {}
-
-			return optional_ref(std::move(result));
+		
+		/** @copydoc Freeze(std::ostream&, std::exception_ptr&) const */
+		bool Freeze(std::ostream& _stream) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Freeze(_stream, exception);
 		}
-
+		
 		/**
-		 * @brief Retrieves the value associated with the given key from the fnv1a table.
+		 * @brief Writes the Hashmap to a file in a read-only format which can be mapped into memory and queried in place, replacing the file if it exists.
 		 *
-		 * @tparam Tk The type of the key.
-		 * @param[in] _key The key to retrieve the value for.
+		 * @param[in] _path Path of the file.
 		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
-		 * @return An optional reference to the value associated with the key, or std::nullopt if the key is not present.
-		 * @note This function is noexcept.
+		 * @return True if the Hashmap was written, false otherwise.
+		 * @see Freeze(std::ostream&, std::exception_ptr&) const
 		 */
-		optional_ref Get(const Tk& _key, std::exception_ptr& _exception) const noexcept {
-			
-			const std::shared_lock lock(s_Lock);
+		bool Freeze(const std::string& _path, std::exception_ptr& _exception) const noexcept {
 			
-			typename optional_ref::optional_t result = std::nullopt;
+			auto result = false;
 			
 			try {
-			
-				if (!m_Buckets.empty()) {
-					
-					// Create an index by taking the key's hash value and "wrapping" it with the number of buckets.
-					size_t hash = GetHashcode(_key);
-					size_t i = hash % m_Buckets.size();
+				
+				std::ofstream stream(_path, std::ios::binary | std::ios::trunc);
+				
+				if (!stream) {
+					throw std::runtime_error("Failed to open \"" + _path + "\" for writing.");
+				}
+				
+				if (Freeze(stream, _exception)) {
 					
-					auto& bucket = m_Buckets[i];
+					stream.close();
 					
-					for (auto& kvp : bucket) {
-						
-						if (GetHashcode(kvp.first) == hash) {
-							result = std::cref(kvp.second);
-							break;
-						}
+					if (!stream) {
+						throw std::runtime_error("Failed to write \"" + _path + "\".");
 					}
+					
+					result = true;
 				}
 			}
 			catch (...) {
 				_exception = std::current_exception();
 			}
 			
-			return optional_ref(std::move(result));
+			return result;
+		}
+		
+		/** @copydoc Freeze(const std::string&, std::exception_ptr&) const */
+		bool Freeze(const std::string& _path) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Freeze(_path, exception);
 		}
 		
 		/**
-		 * @brief Trims unused entries from the end of the Hashmap.
+		 * @brief Reduces the capacity of the Hashmap to fit the number of entries it contains.
 		 */
 		void Trim() {
 			
-			const std::unique_lock lock(s_Lock);
-			
-			size_t trimStart = 1U;
+			const auto lock = LockAll<std::unique_lock<Mutex>>();
 			
-			for (size_t i = trimStart; i < m_Buckets.size(); ++i) {
-				if (m_Buckets[i].size() != 0U) {
-					trimStart = i + 1U;
-				}
-			}
+			Finish();
 			
-			if (trimStart < m_Buckets.size()) {
-				m_Buckets.erase(m_Buckets.begin() + trimStart);
+			if (Align(Count()) < m_Buckets.size()) {
+				Resize(Count());
 			}
 		}
 		
@@ -917,15 +4346,16 @@ namespace LouiEriksson {
 		 */
 		[[nodiscard]] std::vector<Tk> Keys() const {
 			
-			const std::shared_lock lock(s_Lock);
+			const auto lock = LockAll<std::shared_lock<Mutex>>();
 			
 			std::vector<Tk> result;
 			
-			for (const auto& bucket : m_Buckets) {
-				for (const auto& kvp : bucket) {
+			ForEachBucket([&result](const bucket_t& _bucket) {
+				
+				for (const auto& kvp : _bucket) {
 					result.emplace_back(kvp.first);
 				}
-			}
+			});
 			
 			return result;
 		}
@@ -936,15 +4366,16 @@ namespace LouiEriksson {
 		 */
 		[[nodiscard]] std::vector<Tv> Values() const {
 			
-			const std::shared_lock lock(s_Lock);
+			const auto lock = LockAll<std::shared_lock<Mutex>>();
 			
 			std::vector<Tv> result;
 			
-			for (const auto& bucket : m_Buckets) {
-				for (const auto& kvp : bucket) {
+			ForEachBucket([&result](const bucket_t& _bucket) {
+				
+				for (const auto& kvp : _bucket) {
 					result.emplace_back(kvp.second);
 				}
-			}
+			});
 			
 			return result;
 		}
@@ -955,15 +4386,16 @@ namespace LouiEriksson {
 		 */
 		[[nodiscard]] std::vector<KeyValuePair> GetAll() const {
 			
-			const std::shared_lock lock(s_Lock);
+			const auto lock = LockAll<std::shared_lock<Mutex>>();
 			
 			std::vector<KeyValuePair> result;
 			
-			for (const auto& bucket : m_Buckets) {
-				for (const auto& kvp : bucket) {
+			ForEachBucket([&result](const bucket_t& _bucket) {
+				
+				for (const auto& kvp : _bucket) {
 					result.emplace_back(kvp);
 				}
-			}
+			});
 			
 			return result;
 		}
@@ -975,9 +4407,11 @@ namespace LouiEriksson {
 		 */
 		void Reserve(const std::size_t& _newSize) {
 			
-			const std::unique_lock lock(s_Lock);
+			const auto lock = LockAll<std::unique_lock<Mutex>>();
 			
-			if (m_Size < _newSize) {
+			Finish();
+			
+			if (m_Buckets.size() < _newSize) {
 				Resize(_newSize);
 			}
 		}
@@ -987,11 +4421,18 @@ namespace LouiEriksson {
 		 */
 		void Clear() noexcept {
 			
-			const std::unique_lock lock(s_Lock);
-			
 			try {
+				
+				const auto lock = LockAll<std::unique_lock<Mutex>>();
+				
 				m_Buckets.clear();
-				m_Size = 0U;
+				
+				Abandon();
+				Detach();
+				
+				for (auto& stripe : m_Stripes) {
+					stripe.m_Size.store(0U, std::memory_order_relaxed);
+				}
 			}
 			catch (const std::exception& e) {
 				std::cerr << e.what() << std::endl;
@@ -1014,39 +4455,92 @@ namespace LouiEriksson {
 #endif
 		const Tv& operator[](const Tk& _key) const {
 
-			const std::shared_lock lock(s_Lock);
+			const std::shared_lock lock(StripeOf(GetHashcode(_key)).m_Lock);
 
 		    return Return(_key);
 		}
 		
 		/* ITERATORS */
 		
+		class SnapshotView;
+		
 		/**
 		 * @class const_iterator
 		 * @brief Represents an iterator to traverse through the elements in a Hashmap.
+		 * @details While a resize is in progress, the buckets of m_Buckets are followed by those of the resize's target, so entries already moved are still visited.
 		 */
 		class const_iterator final {
 		
 			friend Hashmap;
+			friend SnapshotView;
 			
-			using outer_itr = typename std::vector<std::vector<KeyValuePair>>::const_iterator;
-			using inner_itr = typename std::vector<KeyValuePair>::const_iterator;
+			using buckets_t = std::vector<bucket_t>;
+			using inner_itr = typename bucket_t::const_iterator;
 			
 		private:
 			
-			outer_itr m_Outer;
-			outer_itr m_Outer_End;
+			const buckets_t* m_Buckets;
+			
+			/** @brief Buckets shared with snapshots, or nullptr if every bucket of m_Buckets is owned. */
+			const buckets_t* m_Shared;
+			const std::vector<char>* m_Owned;
+			
+			/** @brief Target of the in-progress resize, or nullptr if the Hashmap is not being resized. */
+			const buckets_t* m_Target;
+			
+			size_t m_Index;
 			inner_itr m_Inner;
 			
-			constexpr const_iterator(const outer_itr& _outer,
-			                         const outer_itr& _outer_end,
-			                         const inner_itr& _inner) :
-				    m_Outer(_outer),
-				m_Outer_End(_outer_end),
-				    m_Inner(_inner)
+			constexpr const_iterator(const buckets_t& _buckets,
+			                         const buckets_t* _shared,
+			                         const std::vector<char>* _owned,
+			                         const buckets_t* _target,
+			                         const size_t& _index) :
+				m_Buckets(&_buckets),
+				 m_Shared(_shared),
+				  m_Owned(_owned),
+				 m_Target(_target),
+				  m_Index(_index),
+				  m_Inner()
 			{
-				if (m_Outer != m_Outer_End && m_Inner == m_Outer->end()) {
-					++(*this);
+				if (m_Index < Size()) {
+					
+					m_Inner = Bucket().begin();
+					
+					if (m_Inner == Bucket().end()) {
+						Skip();
+					}
+				}
+			}
+			
+			/** @brief Returns the number of buckets traversed, including those of the resize's target. */
+			constexpr size_t Size() const noexcept {
+				return m_Buckets->size() + (m_Target != nullptr ? m_Target->size() : 0U);
+			}
+			
+			/** @brief Returns the bucket at the current index, which may be shared with a snapshot or belong to the resize's target. */
+			constexpr const bucket_t& Bucket() const {
+				
+				if (m_Index >= m_Buckets->size()) {
+					return (*m_Target)[m_Index - m_Buckets->size()];
+				}
+				
+				return m_Shared != nullptr && (*m_Owned)[m_Index] == 0 ? (*m_Shared)[m_Index] : (*m_Buckets)[m_Index];
+			}
+			
+			/** @brief Advances to the next non-empty bucket, or to the end if there are none. */
+			constexpr void Skip() {
+				
+				while (++m_Index < Size()) {
+					
+					if (!Bucket().empty()) {
+						m_Inner = Bucket().begin();
+						break;
+					}
+				}
+				if (m_Index >= Size()) {
+					m_Index = Size();
+					m_Inner = inner_itr();
 				}
 			}
 			
@@ -1054,30 +4548,480 @@ namespace LouiEriksson {
 			
 			const const_iterator& operator ++() {
 				
-				if (++m_Inner == m_Outer->end()) {
+				if (++m_Inner == Bucket().end()) {
+					Skip();
+				}
+				return *this;
+			}
+			
+			const KeyValuePair& operator *() const { return *m_Inner; }
+			
+			bool operator ==(const const_iterator& other) const { return ((m_Index == other.m_Index) && (m_Index == Size() || m_Inner == other.m_Inner)); }
+			bool operator !=(const const_iterator& other) const { return !operator ==(other); }
+		};
+		
+		const_iterator begin() const { return const_iterator(m_Buckets, m_Shared.m_Buckets.get(), &m_Shared.m_Owned, Target(), 0U); }
+		const_iterator   end() const { return const_iterator(m_Buckets, m_Shared.m_Buckets.get(), &m_Shared.m_Owned, Target(), m_Buckets.size() + (Target() != nullptr ? Target()->size() : 0U)); }
+		
+		/**
+		 * @class SnapshotView
+		 * @brief An immutable, versioned view of the Hashmap at the moment a snapshot was taken. See Hashmap::Snapshot.
+		 * @details The view shares its buckets with the Hashmap, and holds no locks. It may be copied, read from any number of threads,
+		 *          and outlive the Hashmap it was taken from.
+		 */
+		class SnapshotView final {
+			
+			friend Hashmap;
+			
+		private:
+			
+			using buckets_t = std::vector<bucket_t>;
+			
+			std::shared_ptr<const buckets_t> m_Buckets;
+			
+			size_t m_Size;
+			size_t m_Version;
+			
+			SnapshotView(std::shared_ptr<const buckets_t> _buckets, const size_t& _size, const size_t& _version) noexcept :
+				m_Buckets(std::move(_buckets)),
+				   m_Size(_size),
+				m_Version(_version) {}
+			
+			/** @brief Returns the buckets of the snapshot, or an empty array if there are none. */
+			const buckets_t& Buckets() const noexcept {
+				
+				static const buckets_t s_Empty;
+				
+				return m_Buckets != nullptr ? *m_Buckets : s_Empty;
+			}
+			
+			/**
+			 * @brief Finds the entry with the given key.
+			 * @param[in] _key Key of the entry.
+			 * @return The entry, or nullptr if none exists.
+			 */
+			const KeyValuePair* Locate(const Tk& _key) const {
+				
+				const KeyValuePair* result = nullptr;
+				
+				const auto& buckets = Buckets();
+				
+				if (!buckets.empty()) {
+					
+					const auto hash = GetHashcode(_key);
 					
-					while (++m_Outer != m_Outer_End) {
+					for (const auto& kvp : buckets[Spread(hash) % buckets.size()]) {
 						
-						if (!m_Outer->empty()) {
-							m_Inner = m_Outer->begin();
+						if (GetHashcode(kvp.first) == hash) {
+							result = &kvp;
+							
 							break;
 						}
 					}
-					if (m_Outer == m_Outer_End) {
-						m_Inner = inner_itr();
+				}
+				
+				return result;
+			}
+			
+		public:
+			
+			/** @brief Constructs an empty snapshot. */
+			SnapshotView() noexcept :
+				   m_Size(0U),
+				m_Version(0U) {}
+			
+			[[nodiscard]] size_t size() const noexcept { return m_Size; }
+			
+			[[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+			
+			/**
+			 * @brief Returns the version of the snapshot.
+			 * @details Versions increase with each snapshot taken of the same Hashmap, starting from one.
+			 *
+			 * @return The version of the snapshot, or zero if it is empty.
+			 */
+			[[nodiscard]] size_t version() const noexcept { return m_Version; }
+			
+			/**
+			 * @brief Determines whether the snapshot contains the given key.
+			 * @param[in] _key Key to check for.
+			 * @return True if the key exists, false otherwise.
+			 */
+			bool ContainsKey(const Tk& _key) const noexcept {
+				
+				auto result = false;
+				
+				try {
+					result = Locate(_key) != nullptr;
+				}
+				catch (...) {}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Retrieves the value associated with the given key.
+			 * @param[in] _key Key of the entry.
+			 * @return An optional reference to the value, valid for the lifetime of the snapshot, or std::nullopt if the key is not present.
+			 */
+			optional_ref Get(const Tk& _key) const noexcept {
+				
+				typename optional_ref::optional_t result = std::nullopt;
+				
+				try {
+					
+					if (const auto* entry = Locate(_key)) {
+						result = std::cref(entry->second);
 					}
 				}
-				return *this;
+				catch (...) {}
+				
+				return optional_ref(std::move(result));
 			}
 			
-			const KeyValuePair& operator *() const { return *m_Inner; }
+			const_iterator begin() const { return const_iterator(Buckets(), nullptr, nullptr, nullptr, 0U); }
+			const_iterator   end() const { return const_iterator(Buckets(), nullptr, nullptr, nullptr, Buckets().size()); }
+		};
+		
+		/**
+		 * @brief Takes an immutable snapshot of the Hashmap in O(buckets), without copying any entries.
+		 * @details The buckets of the Hashmap are shared with the snapshot, and each is copied (at bucket granularity) the first time
+		 *          it is modified while the snapshot is alive. Resizing the Hashmap, or taking another snapshot, while a snapshot is alive
+		 *          copies the buckets which have not yet been modified.
+		 *          If the policy is Stable, every entry is instead copied into the snapshot in O(n), so that the entries of the Hashmap never move.
+		 *
+		 * @code
+		 * const auto snapshot = hashmap.Snapshot();
+		 *
+		 * for (const auto& [key, value] : snapshot) {
+		 *     ...
+		 * }
+		 * @endcode
+		 *
+		 * @return A snapshot of the Hashmap.
+		 * @throw std::bad_alloc If the snapshot could not be allocated.
+		 */
+		[[nodiscard]] SnapshotView Snapshot() {
 			
-			bool operator ==(const const_iterator& other) const { return ((m_Outer == other.m_Outer) && (m_Outer == m_Outer_End || m_Inner == other.m_Inner)); }
-			bool operator !=(const const_iterator& other) const { return !operator ==(other); }
+			const auto lock = LockAll<std::unique_lock<Mutex>>();
+			
+			Finish();
+			
+			std::shared_ptr<std::vector<bucket_t>> shared;
+			
+			if constexpr (TPolicy::Stable) {
+			
+				// Sharing the buckets would relocate each entry of the Hashmap the first time its bucket is written to, so copy them instead.
+				shared = std::make_shared<std::vector<bucket_t>>(m_Buckets);
+			}
+			else {
+				
+				shared = std::make_shared<std::vector<bucket_t>>(m_Buckets.size());
+				
+				auto owned = std::vector<char>(m_Buckets.size(), 0);
+				
+				shared->swap(m_Buckets);
+				
+				m_Shared.m_Buckets = shared;
+				m_Shared.m_Owned   = std::move(owned);
+			}
+			
+			return SnapshotView(std::move(shared), Count(), ++m_Shared.m_Version);
+		}
+		
+		/**
+		 * @class PerfectHashmap
+		 * @brief An immutable map from a fixed set of keys, using a minimal perfect hash function. See Hashmap::ToPerfectHashmap.
+		 * @details Keys are assigned to buckets of (on average) s_Load keys, and each bucket stores a pilot chosen so that its keys land in distinct,
+		 *          unoccupied slots (as described by Pibiri and Trani's PTHash). Every key therefore maps to its own slot in a table with no empty slots,
+		 *          and a lookup is a single probe with no collision handling. The function itself costs 32 / s_Load bits per key.
+		 *          Each slot also holds the hashcode of its key, so that keys outside of the set are rejected; as with Hashmap, keys are compared by hashcode.
+		 */
+		class PerfectHashmap final {
+			
+			friend Hashmap;
+			
+		private:
+			
+			/** @brief Average number of keys per bucket. */
+			static constexpr size_t s_Load = 4U;
+			
+			/** @brief Number of seeds tried before construction is abandoned. */
+			static constexpr uint64_t s_Attempts = 16U;
+			
+			uint64_t m_Seed;
+			
+			std::vector<uint32_t> m_Pilots;
+			std::vector<size_t>   m_Hashes;
+			std::vector<Tv>       m_Values;
+			
+			/**
+			 * @brief Mixes the bits of a 64-bit integer (the finaliser of MurmurHash3).
+			 * @param[in] _value Value to mix.
+			 * @return The mixed value.
+			 */
+			static constexpr uint64_t Mix(uint64_t _value) noexcept {
+				
+				_value ^= _value >> 33U;
+				_value *= 0xFF51AFD7ED558CCDULL;
+				_value ^= _value >> 33U;
+				_value *= 0xC4CEB9FE1A85EC53ULL;
+				_value ^= _value >> 33U;
+				
+				return _value;
+			}
+			
+			/**
+			 * @brief Returns the bucket of a hashcode.
+			 * @param[in] _hash Hashcode of the key.
+			 * @param[in] _seed Seed of the function.
+			 * @param[in] _buckets Number of buckets.
+			 * @return Index of the bucket.
+			 */
+			static constexpr size_t BucketOf(const size_t& _hash, const uint64_t& _seed, const size_t& _buckets) noexcept {
+				return static_cast<size_t>(Mix(static_cast<uint64_t>(_hash) + (_seed * 0x9E3779B97F4A7C15ULL)) % _buckets);
+			}
+			
+			/**
+			 * @brief Returns the slot of a hashcode, given the pilot of its bucket.
+			 * @param[in] _hash Hashcode of the key.
+			 * @param[in] _pilot Mixed pilot of the key's bucket (see Mix).
+			 * @param[in] _slots Number of slots.
+			 * @return Index of the slot.
+			 */
+			static constexpr size_t SlotOf(const size_t& _hash, const uint64_t& _pilot, const size_t& _slots) noexcept {
+				return static_cast<size_t>(Mix(static_cast<uint64_t>(_hash) ^ _pilot) % _slots);
+			}
+			
+			/**
+			 * @brief Finds the slot of the entry with the given key.
+			 * @param[in] _key Key of the entry.
+			 * @return Index of the slot, or the number of slots if the key is not present.
+			 */
+			size_t Locate(const Tk& _key) const {
+				
+				auto result = m_Hashes.size();
+				
+				if (!m_Hashes.empty()) {
+					
+					const auto hash = GetHashcode(_key);
+					const auto slot = SlotOf(hash, Mix(m_Pilots[BucketOf(hash, m_Seed, m_Pilots.size())] ^ m_Seed), m_Hashes.size());
+					
+					if (m_Hashes[slot] == hash) {
+						result = slot;
+					}
+				}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Constructs a PerfectHashmap from a set of entries with distinct hashcodes.
+			 * @param[in] _entries Hashcode and entry of each key.
+			 * @throw std::runtime_error If no perfect hash function was found.
+			 */
+			explicit PerfectHashmap(const std::vector<std::pair<size_t, const KeyValuePair*>>& _entries) :
+				m_Seed(0U)
+			{
+				if (_entries.empty()) {
+					return;
+				}
+				
+				const auto slots   = _entries.size();
+				const auto buckets = (slots + s_Load - 1U) / s_Load;
+				
+				std::vector<size_t> placed(_entries.size());
+				
+				auto found = false;
+				
+				for (; !found && m_Seed < s_Attempts; ++m_Seed) {
+					
+					// Group the keys by bucket with a counting sort.
+					std::vector<size_t> offsets(buckets + 1U, 0U);
+					
+					for (const auto& entry : _entries) {
+						++offsets[BucketOf(entry.first, m_Seed, buckets) + 1U];
+					}
+					
+					for (size_t i = 1U; i < offsets.size(); ++i) {
+						offsets[i] += offsets[i - 1U];
+					}
+					
+					std::vector<size_t> members(slots);
+					
+					{
+						auto next = offsets;
+						
+						for (size_t i = 0U; i < slots; ++i) {
+							members[next[BucketOf(_entries[i].first, m_Seed, buckets)]++] = i;
+						}
+					}
+					
+					// Place the largest buckets first, while the table is emptiest.
+					std::vector<size_t> order(buckets);
+					
+					for (size_t i = 0U; i < buckets; ++i) {
+						order[i] = i;
+					}
+					
+					std::stable_sort(order.begin(), order.end(), [&offsets](const size_t& _a, const size_t& _b) {
+						return offsets[_a + 1U] - offsets[_a] > offsets[_b + 1U] - offsets[_b];
+					});
+					
+					m_Pilots.assign(buckets, 0U);
+					
+					std::vector<char> taken(slots, 0);
+					
+					found = true;
+					
+					for (const auto& bucket : order) {
+						
+						const auto begin = offsets[bucket];
+						const auto end   = offsets[bucket + 1U];
+						
+						if (begin == end) {
+							break;
+						}
+						
+						auto pilot = static_cast<uint64_t>(0U);
+						
+						for (; pilot <= UINT32_MAX; ++pilot) {
+							
+							const auto mixed = Mix(pilot ^ m_Seed);
+							
+							auto i = begin;
+							
+							for (; i < end; ++i) {
+								
+								const auto slot = SlotOf(_entries[members[i]].first, mixed, slots);
+								
+								if (taken[slot] != 0) {
+									break;
+								}
+								
+								taken[slot] = 1;
+								
+								placed[members[i]] = slot;
+							}
+							
+							if (i == end) {
+								break;
+							}
+							
+							// Release the slots claimed by this pilot before trying the next.
+							for (auto j = begin; j < i; ++j) {
+								taken[placed[members[j]]] = 0;
+							}
+						}
+						
+						if (pilot > UINT32_MAX) {
+							found = false;
+							
+							break;
+						}
+						
+						m_Pilots[bucket] = static_cast<uint32_t>(pilot);
+					}
+					
+					if (found) {
+						break;
+					}
+				}
+				
+				if (!found) {
+					throw std::runtime_error("Failed to find a perfect hash function for the keys.");
+				}
+				
+				std::vector<const KeyValuePair*> entries(slots);
+				
+				m_Hashes.resize(slots);
+				
+				for (size_t i = 0U; i < slots; ++i) {
+					entries [placed[i]] = _entries[i].second;
+					m_Hashes[placed[i]] = _entries[i].first;
+				}
+				
+				m_Values.reserve(slots);
+				
+				for (const auto* entry : entries) {
+					m_Values.emplace_back(entry->second);
+				}
+			}
+			
+		public:
+			
+			/** @brief Constructs an empty PerfectHashmap. */
+			PerfectHashmap() noexcept :
+				m_Seed(0U) {}
+			
+			[[nodiscard]] size_t size() const noexcept { return m_Values.size(); }
+			
+			[[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+			
+			/**
+			 * @brief Determines whether the PerfectHashmap contains the given key.
+			 * @param[in] _key Key to check for.
+			 * @return True if the key exists, false otherwise.
+			 */
+			bool ContainsKey(const Tk& _key) const noexcept {
+				
+				auto result = false;
+				
+				try {
+					result = Locate(_key) != m_Hashes.size();
+				}
+				catch (...) {}
+				
+				return result;
+			}
+			
+			/**
+			 * @brief Retrieves the value associated with the given key.
+			 * @param[in] _key Key of the entry.
+			 * @return An optional reference to the value, or std::nullopt if the key is not present.
+			 */
+			optional_ref Get(const Tk& _key) const noexcept {
+				
+				typename optional_ref::optional_t result = std::nullopt;
+				
+				try {
+					
+					const auto slot = Locate(_key);
+					
+					if (slot != m_Hashes.size()) {
+						result = std::cref(m_Values[slot]);
+					}
+				}
+				catch (...) {}
+				
+				return optional_ref(std::move(result));
+			}
 		};
 		
-		constexpr const_iterator begin() const { return const_iterator(m_Buckets.begin(), m_Buckets.end(), m_Buckets.empty() ? typename std::vector<KeyValuePair>::const_iterator() : m_Buckets.begin()->begin()); }
-		constexpr const_iterator   end() const { return const_iterator(m_Buckets.end(),   m_Buckets.end(), typename std::vector<KeyValuePair>::const_iterator()); }
+		/**
+		 * @brief Compiles the current keys of the Hashmap into an immutable PerfectHashmap, whose lookups are a single probe.
+		 * @details Intended for data which no longer changes once loaded. Construction takes expected O(n log n) time.
+		 *
+		 * @return A PerfectHashmap holding a copy of every entry.
+		 * @throw std::runtime_error If no perfect hash function was found.
+		 * @throw std::bad_alloc If the PerfectHashmap could not be allocated.
+		 */
+		[[nodiscard]] PerfectHashmap ToPerfectHashmap() const {
+			
+			const auto lock = LockAll<std::shared_lock<Mutex>>();
+			
+			std::vector<std::pair<size_t, const KeyValuePair*>> entries;
+			entries.reserve(Count());
+			
+			ForEachBucket([&entries](const bucket_t& _bucket) {
+				
+				for (const auto& kvp : _bucket) {
+					entries.emplace_back(GetHashcode(kvp.first), &kvp);
+				}
+			});
+			
+			return PerfectHashmap(entries);
+		}
 	};
 	
 } // LouiEriksson
@@ -0,0 +1,613 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef LOUIERIKSSON_ORDEREDHASHMAP_HPP
+#define LOUIERIKSSON_ORDEREDHASHMAP_HPP
+
+#include "Hashmap.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @brief A Hashmap which stores its entries densely, in insertion order.
+	 * @details Entries are appended to a single vector, and found through a separate open-addressed index of 32-bit entry positions, probed linearly.
+	 *          Iterating the map, or copying its keys or values, is therefore a sequential scan of memory in the order the entries were inserted.
+	 *          Removal leaves a tombstone in both the entries and the index, preserving the order of the remaining entries, and the entries are
+	 *          compacted (and the index rebuilt) once tombstones outnumber them. As with Hashmap, keys are compared by hashcode.
+	 *
+	 * @tparam Tk Key type of the OrderedHashmap.
+	 * @tparam Tv Value type of the OrderedHashmap.
+	 */
+	template<typename Tk, typename Tv>
+	class OrderedHashmap final {
+		
+	public:
+		
+		using KeyValuePair = typename Hashmap<Tk, Tv>::KeyValuePair;
+		
+	private:
+		
+		/** @brief An entry of the OrderedHashmap, or a tombstone if it has been removed. */
+		struct Entry final {
+			
+			size_t m_Hash;
+			
+			std::optional<KeyValuePair> m_Pair;
+		};
+		
+		/** @brief Value of an empty slot of the index. */
+		static constexpr uint32_t s_Empty = 0U;
+		
+		/** @brief Value of a slot of the index whose entry has been removed. */
+		static constexpr uint32_t s_Removed = UINT32_MAX;
+		
+		/** @brief Minimum number of slots of the index. */
+		static constexpr size_t s_MinimumCapacity = 16U;
+		
+		mutable std::shared_mutex m_Lock;
+		
+		/** @brief Entries in insertion order, including tombstones. */
+		std::vector<Entry> m_Entries;
+		
+		/** @brief Position of each entry within m_Entries plus one, or s_Empty or s_Removed. Its size is always a power of two. */
+		std::vector<uint32_t> m_Index;
+		
+		/** @brief Number of live entries. */
+		size_t m_Size { 0U };
+		
+		/** @brief Number of slots of the index which are not empty, including those of removed entries. */
+		size_t m_Used { 0U };
+		
+		/**
+		 * @brief Calculates the hashcode of a given key.
+		 * @param[in] _item Key to calculate the hash of.
+		 * @return Hashcode of _item.
+		 */
+		static constexpr size_t GetHashcode(const Tk& _item) {
+			return std::hash<Tk>()(_item);
+		}
+		
+		/**
+		 * @brief Returns the first slot of the index to probe for a hashcode.
+		 * @details The hashcode is mixed by Fibonacci hashing, as the index is a power of two in size and std::hash is often the identity.
+		 *
+		 * @param[in] _hash Hashcode of the key.
+		 * @return Index of the slot.
+		 */
+		size_t Home(const size_t& _hash) const noexcept {
+			return static_cast<size_t>((static_cast<uint64_t>(_hash) * 0x9E3779B97F4A7C15ULL) >> 32U) & (m_Index.size() - 1U);
+		}
+		
+		/**
+		 * @brief Finds the slot of the index referring to the live entry with the given hashcode. The caller must hold the lock.
+		 * @param[in] _hash Hashcode of the key.
+		 * @return Index of the slot, or the size of the index if no entry exists.
+		 */
+		size_t Locate(const size_t& _hash) const noexcept {
+			
+			auto result = m_Index.size();
+			
+			if (!m_Index.empty()) {
+				
+				for (auto slot = Home(_hash); m_Index[slot] != s_Empty; slot = (slot + 1U) & (m_Index.size() - 1U)) {
+					
+					const auto position = m_Index[slot];
+					
+					if (position != s_Removed && m_Entries[position - 1U].m_Hash == _hash) {
+						result = slot;
+						
+						break;
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Removes every tombstone from the entries, and rebuilds the index with the given number of slots. The caller must hold the lock exclusively.
+		 * @details If an exception is thrown, the OrderedHashmap is left unchanged.
+		 * @param[in] _capacity Number of slots of the new index. Must be a power of two greater than the number of entries.
+		 */
+		void Rebuild(const size_t& _capacity) {
+			
+			std::vector<uint32_t> index(_capacity, s_Empty);
+			
+			if (m_Size != m_Entries.size()) {
+				
+				// Compact in place, preserving the order of the live entries.
+				m_Entries.erase(std::remove_if(m_Entries.begin(), m_Entries.end(), [](const Entry& _entry) { return !_entry.m_Pair.has_value(); }), m_Entries.end());
+			}
+			
+			m_Index.swap(index);
+			
+			for (size_t i = 0U; i < m_Entries.size(); ++i) {
+				
+				auto slot = Home(m_Entries[i].m_Hash);
+				
+				while (m_Index[slot] != s_Empty) {
+					slot = (slot + 1U) & (m_Index.size() - 1U);
+				}
+				
+				m_Index[slot] = static_cast<uint32_t>(i + 1U);
+			}
+			
+			m_Used = m_Entries.size();
+		}
+		
+		/**
+		 * @brief Returns the number of slots of the index needed for a number of entries.
+		 * @param[in] _count Number of entries.
+		 * @return The smallest power of two which is at least twice _count, and at least s_MinimumCapacity.
+		 */
+		static size_t CapacityFor(const size_t& _count) noexcept {
+			
+			auto result = s_MinimumCapacity;
+			
+			while (result < _count * 2U) {
+				result *= 2U;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Inserts or replaces the entry with the given key. The caller must hold the lock exclusively.
+		 * @details If an exception is thrown, the OrderedHashmap is left unchanged.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[in] _replace Whether to replace the value of an existing entry.
+		 * @return True if an entry was inserted or replaced, false otherwise.
+		 */
+		bool Store(const Tk& _key, const Tv& _value, const bool& _replace) {
+			
+			auto result = false;
+			
+			const auto hash  = GetHashcode(_key);
+			const auto found = Locate(hash);
+			
+			if (found != m_Index.size()) {
+				
+				if (_replace) {
+					m_Entries[m_Index[found] - 1U].m_Pair->second = _value;
+					
+					result = true;
+				}
+			}
+			else {
+				
+				if (m_Entries.size() >= s_Removed - 1U) {
+					throw std::length_error("The OrderedHashmap cannot hold any more entries.");
+				}
+				
+				// Keep the index at most half full, counting the slots of removed entries.
+				if ((m_Used + 1U) * 2U > m_Index.size()) {
+					Rebuild(CapacityFor(m_Size + 1U));
+				}
+				
+				m_Entries.push_back({ hash, KeyValuePair(_key, _value) });
+				
+				auto slot = Home(hash);
+				
+				while (m_Index[slot] != s_Empty && m_Index[slot] != s_Removed) {
+					slot = (slot + 1U) & (m_Index.size() - 1U);
+				}
+				
+				if (m_Index[slot] == s_Empty) {
+					++m_Used;
+				}
+				
+				m_Index[slot] = static_cast<uint32_t>(m_Entries.size());
+				
+				++m_Size;
+				
+				result = true;
+			}
+			
+			return result;
+		}
+		
+	public:
+		
+		/**
+		 * @class const_iterator
+		 * @brief Represents an iterator to traverse through the entries of an OrderedHashmap in insertion order.
+		 */
+		class const_iterator final {
+			
+			friend OrderedHashmap;
+			
+			using itr_t = typename std::vector<Entry>::const_iterator;
+			
+		private:
+			
+			itr_t m_Current;
+			itr_t m_End;
+			
+			const_iterator(const itr_t& _current, const itr_t& _end) :
+				m_Current(_current),
+				    m_End(_end)
+			{
+				Skip();
+			}
+			
+			/** @brief Advances past any tombstones. */
+			void Skip() {
+				
+				while (m_Current != m_End && !m_Current->m_Pair.has_value()) {
+					++m_Current;
+				}
+			}
+			
+		public:
+			
+			const const_iterator& operator ++() {
+				
+				++m_Current;
+				
+				Skip();
+				
+				return *this;
+			}
+			
+			const KeyValuePair& operator *() const { return *m_Current->m_Pair; }
+			
+			bool operator ==(const const_iterator& other) const { return m_Current == other.m_Current; }
+			bool operator !=(const const_iterator& other) const { return !operator ==(other); }
+		};
+		
+		OrderedHashmap() noexcept = default;
+		
+		/**
+		 * @brief Initialise OrderedHashmap using a collection of key-value pairs, in order.
+		 * @details Duplicate keys replace the value of the first occurrence, which keeps its position.
+		 *
+		 * @param[in] _items A collection of key-value pairs.
+		 */
+		OrderedHashmap(const std::initializer_list<KeyValuePair>& _items) {
+			
+			Reserve(_items.size());
+			
+			for (const auto& item : _items) {
+				Store(item.first, item.second, true);
+			}
+		}
+		
+		OrderedHashmap(const OrderedHashmap&) = delete;
+		OrderedHashmap& operator = (const OrderedHashmap&) = delete;
+		
+		/** @brief Returns the number of entries in the OrderedHashmap. */
+		[[nodiscard]] size_t size() const noexcept {
+			
+			const std::shared_lock lock(m_Lock);
+			
+			return m_Size;
+		}
+		
+		[[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+		
+		/**
+		 * @brief Determines whether the OrderedHashmap contains the given key.
+		 *
+		 * @param[in] _key Key to check for.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if the key exists, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				const std::shared_lock lock(m_Lock);
+				
+				result = Locate(hash) != m_Index.size();
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc ContainsKey(const Tk&, std::exception_ptr&) const */
+		bool ContainsKey(const Tk& _key) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return ContainsKey(_key, exception);
+		}
+		
+		/**
+		 * @brief Appends a new entry with the given key and value, if one does not already exist.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const std::unique_lock lock(m_Lock);
+				
+				result = Store(_key, _value, false);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Add(const Tk&, const Tv&, std::exception_ptr&) */
+		bool Add(const Tk& _key, const Tv& _value) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Add(_key, _value, exception);
+		}
+		
+		/**
+		 * @brief Replaces the value of the entry with the given key in place, or appends a new entry if none exists.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 */
+		void Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			try {
+				
+				const std::unique_lock lock(m_Lock);
+				
+				Store(_key, _value, true);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+		}
+		
+		/** @copydoc Assign(const Tk&, const Tv&, std::exception_ptr&) */
+		void Assign(const Tk& _key, const Tv& _value) noexcept {
+			
+			std::exception_ptr exception;
+			
+			Assign(_key, _value, exception);
+		}
+		
+		/**
+		 * @brief Removes the entry with the given key, preserving the order of the remaining entries.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if an entry was removed, false otherwise.
+		 */
+		bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				const std::unique_lock lock(m_Lock);
+				
+				const auto slot = Locate(hash);
+				
+				if (slot != m_Index.size()) {
+					
+					m_Entries[m_Index[slot] - 1U].m_Pair.reset();
+					m_Index[slot] = s_Removed;
+					
+					--m_Size;
+					
+					result = true;
+					
+					// Compact once tombstones outnumber the entries. Failing to compact leaves the map valid, only sparser.
+					if (m_Entries.size() - m_Size > std::max(m_Size, s_MinimumCapacity)) {
+						
+						try {
+							Rebuild(CapacityFor(m_Size));
+						}
+						catch (...) {}
+					}
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Remove(const Tk&, std::exception_ptr&) */
+		bool Remove(const Tk& _key) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Remove(_key, exception);
+		}
+		
+		/**
+		 * @brief Retrieves a copy of the value associated with the given key.
+		 * @details A copy is returned, rather than a reference, as entries move when the OrderedHashmap is compacted or grows.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return The value, or std::nullopt if the key is not present.
+		 */
+		std::optional<Tv> Get(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			std::optional<Tv> result;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				const std::shared_lock lock(m_Lock);
+				
+				const auto slot = Locate(hash);
+				
+				if (slot != m_Index.size()) {
+					result.emplace(m_Entries[m_Index[slot] - 1U].m_Pair->second);
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Get(const Tk&, std::exception_ptr&) const */
+		std::optional<Tv> Get(const Tk& _key) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Get(_key, exception);
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all keys stored within the OrderedHashmap, in insertion order.
+		 * @return A shallow copy of all keys stored within the OrderedHashmap.
+		 */
+		[[nodiscard]] std::vector<Tk> Keys() const {
+			
+			const std::shared_lock lock(m_Lock);
+			
+			std::vector<Tk> result;
+			result.reserve(m_Size);
+			
+			for (const auto& entry : m_Entries) {
+				
+				if (entry.m_Pair.has_value()) {
+					result.emplace_back(entry.m_Pair->first);
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all values stored within the OrderedHashmap, in insertion order.
+		 * @return A shallow copy of all values stored within the OrderedHashmap.
+		 */
+		[[nodiscard]] std::vector<Tv> Values() const {
+			
+			const std::shared_lock lock(m_Lock);
+			
+			std::vector<Tv> result;
+			result.reserve(m_Size);
+			
+			for (const auto& entry : m_Entries) {
+				
+				if (entry.m_Pair.has_value()) {
+					result.emplace_back(entry.m_Pair->second);
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all entries stored within the OrderedHashmap, in insertion order.
+		 * @return A shallow copy of all entries stored within the OrderedHashmap.
+		 */
+		[[nodiscard]] std::vector<KeyValuePair> GetAll() const {
+			
+			const std::shared_lock lock(m_Lock);
+			
+			std::vector<KeyValuePair> result;
+			result.reserve(m_Size);
+			
+			for (const auto& entry : m_Entries) {
+				
+				if (entry.m_Pair.has_value()) {
+					result.emplace_back(*entry.m_Pair);
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Reserves memory for the OrderedHashmap to hold at least _newSize entries without growing.
+		 * @param[in] _newSize The minimum number of entries to reserve memory for.
+		 */
+		void Reserve(const size_t& _newSize) {
+			
+			const std::unique_lock lock(m_Lock);
+			
+			m_Entries.reserve(_newSize);
+			
+			if (CapacityFor(_newSize) > m_Index.size()) {
+				Rebuild(CapacityFor(_newSize));
+			}
+		}
+		
+		/**
+		 * @brief Clears all entries from the OrderedHashmap.
+		 */
+		void Clear() noexcept {
+			
+			const std::unique_lock lock(m_Lock);
+			
+			m_Entries.clear();
+			m_Index.clear();
+			
+			m_Size = 0U;
+			m_Used = 0U;
+		}
+		
+		/* ITERATORS */
+		
+		/** @warning Iteration does not hold the lock. The OrderedHashmap must not be modified while it is iterated. */
+		const_iterator begin() const { return const_iterator(m_Entries.begin(), m_Entries.end()); }
+		const_iterator   end() const { return const_iterator(m_Entries.end(),   m_Entries.end()); }
+	};
+	
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_ORDEREDHASHMAP_HPP
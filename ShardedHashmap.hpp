@@ -0,0 +1,430 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUIERIKSSON_SHARDEDHASHMAP_HPP
+#define LOUIERIKSSON_SHARDEDHASHMAP_HPP
+
+#include "Hashmap.hpp"
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @brief A Hashmap partitioned into a fixed number of independent shards.
+	 * @details Each key is routed to a shard using the high bits of its (mixed) hashcode, leaving the low bits for bucket selection within the shard.
+	 *          Every shard has its own locks, capacity and cache line, so writers on different shards never contend and shards resize independently.
+	 *          Operations spanning every shard (such as size() and iteration) are not atomic with respect to concurrent writers.
+	 *
+	 * @tparam Tk Key type of the ShardedHashmap.
+	 * @tparam Tv Value type of the ShardedHashmap.
+	 * @tparam N Number of shards. Must be a power of two.
+	 * @tparam TPolicy Configuration of each shard. See HashmapPolicy.
+	 */
+	template<typename Tk, typename Tv, size_t N, typename TPolicy = HashmapPolicy>
+	class ShardedHashmap final {
+		
+		static_assert(N > 0U && (N & (N - 1U)) == 0U, "The number of shards must be a non-zero power of two.");
+	
+	public:
+	
+		using shard_t = Hashmap<Tk, Tv, TPolicy>;
+		
+		using KeyValuePair  = typename shard_t::KeyValuePair;
+		using optional_ref  = typename shard_t::optional_ref;
+		using ConstAccessor = typename shard_t::ConstAccessor;
+		using Accessor      = typename shard_t::Accessor;
+	
+	private:
+	
+		/** @brief A shard of the ShardedHashmap, aligned to a cache line so that neighbouring shards do not share one. */
+		struct alignas(64U) PaddedShard final {
+			shard_t m_Map;
+		};
+		
+		/** @brief Shards of the ShardedHashmap. */
+		std::array<PaddedShard, N> m_Shards;
+		
+		/**
+		 * @brief Calculates the base-2 logarithm of a power of two.
+		 * @param[in] _value A power of two.
+		 * @return The base-2 logarithm of _value.
+		 */
+		static constexpr size_t Log2(const size_t& _value) noexcept {
+			return _value > 1U ? Log2(_value >> 1U) + 1U : 0U;
+		}
+		
+		/**
+		 * @brief Selects the index of the shard responsible for the given key.
+		 * @details The hashcode is multiplied by the golden ratio (Fibonacci hashing) before its high bits are taken,
+		 *          as many std::hash specialisations (such as those for integers) leave the high bits empty.
+		 *          Should hashing the key fail, the first shard is selected so that its own operation can report the failure.
+		 *
+		 * @param[in] _key Key to select the shard of.
+		 * @return The index of the shard responsible for _key.
+		 */
+		static size_t ShardIndex(const Tk& _key) noexcept {
+			
+			if constexpr (N > 1U) {
+				
+				try {
+					constexpr size_t shift = (sizeof(size_t) * CHAR_BIT) - Log2(N);
+					
+					return (std::hash<Tk>()(_key) * static_cast<size_t>(0x9E3779B97F4A7C15ULL)) >> shift;
+				}
+				catch (...) {}
+			}
+			
+			return 0U;
+		}
+	
+	public:
+	
+		/**
+		 * @brief Initialise ShardedHashmap.
+		 * @param[in] _capacity Initial capacity of the ShardedHashmap, divided evenly between the shards.
+		 */
+		ShardedHashmap(const size_t& _capacity = N) {
+			
+			for (auto& shard : m_Shards) {
+				shard.m_Map.Reserve((_capacity + N - 1U) / N);
+			}
+		}
+		
+		/**
+		 * @brief Initialise ShardedHashmap using a collection of key-value pairs.
+		 * @details Please note: The provided collection should be distinct. Otherwise, some data loss may occur as duplicate entries will be ignored.
+		 *
+		 * @param[in] _items A collection of key-value pairs.
+		 */
+		ShardedHashmap(const std::initializer_list<KeyValuePair>& _items) : ShardedHashmap(_items.size()) {
+			
+			for (const auto& item : _items) {
+				Assign(item.first, item.second);
+			}
+		}
+		
+		/**
+		 * @brief Returns the shard responsible for the given key.
+		 * @param[in] _key Key of the entry.
+		 * @return The shard responsible for _key.
+		 */
+		[[nodiscard]] shard_t& Shard(const Tk& _key) noexcept { return m_Shards[ShardIndex(_key)].m_Map; }
+		
+		/**
+		 * @brief Returns the shard responsible for the given key.
+		 * @param[in] _key Key of the entry.
+		 * @return The shard responsible for _key.
+		 */
+		[[nodiscard]] const shard_t& Shard(const Tk& _key) const noexcept { return m_Shards[ShardIndex(_key)].m_Map; }
+		
+		/**
+		 * @brief Returns the number of items stored within the ShardedHashmap.
+		 * @return The sum of the number of items stored within each shard.
+		 */
+		[[nodiscard]] size_t size() const noexcept {
+			
+			size_t result = 0U;
+			
+			for (const auto& shard : m_Shards) {
+				result += shard.m_Map.size();
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Is the ShardedHashmap empty?
+		 * @return Returns true if no shard contains any entries.
+		 */
+		[[nodiscard]] bool empty() const noexcept {
+			
+			for (const auto& shard : m_Shards) {
+				if (!shard.m_Map.empty()) {
+					return false;
+				}
+			}
+			
+			return true;
+		}
+		
+		/** @see Hashmap::ContainsKey(const Tk&) */
+		bool ContainsKey(const Tk& _key) const noexcept {
+			return Shard(_key).ContainsKey(_key);
+		}
+		
+		/** @see Hashmap::ContainsKey(const Tk&, std::exception_ptr&) */
+		bool ContainsKey(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			return Shard(_key).ContainsKey(_key, _exception);
+		}
+		
+		/** @see Hashmap::Add(const Tk&, const Tv&) */
+		bool Add(const Tk& _key, const Tv& _value) noexcept {
+			return Shard(_key).Add(_key, _value);
+		}
+		
+		/** @see Hashmap::Add(const Tk&, const Tv&, std::exception_ptr&) */
+		bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			return Shard(_key).Add(_key, _value, _exception);
+		}
+		
+		/** @see Hashmap::Add(const Tk&&, const Tv&&) */
+		bool Add(const Tk&& _key, const Tv&& _value) noexcept {
+			return Shard(_key).Add(std::move(_key), std::move(_value));
+		}
+		
+		/** @see Hashmap::Add(const Tk&&, const Tv&&, std::exception_ptr&) */
+		bool Add(const Tk&& _key, const Tv&& _value, std::exception_ptr& _exception) noexcept {
+			return Shard(_key).Add(std::move(_key), std::move(_value), _exception);
+		}
+		
+		/** @see Hashmap::Assign(const Tk&, const Tv&) */
+		void Assign(const Tk& _key, const Tv& _value) noexcept {
+			Shard(_key).Assign(_key, _value);
+		}
+		
+		/** @see Hashmap::Assign(const Tk&, const Tv&, std::exception_ptr&) */
+		void Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			Shard(_key).Assign(_key, _value, _exception);
+		}
+		
+		/** @see Hashmap::Assign(Tk&&, Tv&&) */
+		void Assign(Tk&& _key, Tv&& _value) noexcept {
+			Shard(_key).Assign(std::move(_key), std::move(_value));
+		}
+		
+		/** @see Hashmap::Assign(Tk&&, Tv&&, std::exception_ptr&) */
+		void Assign(Tk&& _key, Tv&& _value, std::exception_ptr& _exception) noexcept {
+			Shard(_key).Assign(std::move(_key), std::move(_value), _exception);
+		}
+		
+		/** @see Hashmap::GetOrAdd(const Tk&, Tf&&) */
+		template<typename Tf>
+		optional_ref GetOrAdd(const Tk& _key, Tf&& _factory) noexcept {
+			return Shard(_key).GetOrAdd(_key, std::forward<Tf>(_factory));
+		}
+		
+		/** @see Hashmap::AddOrUpdate(const Tk&, const Tv&, Tf&&) */
+		template<typename Tf>
+		optional_ref AddOrUpdate(const Tk& _key, const Tv& _addValue, Tf&& _update) noexcept {
+			return Shard(_key).AddOrUpdate(_key, _addValue, std::forward<Tf>(_update));
+		}
+		
+		/** @see Hashmap::Compute(const Tk&, Tf&&) */
+		template<typename Tf>
+		optional_ref Compute(const Tk& _key, Tf&& _function) noexcept {
+			return Shard(_key).Compute(_key, std::forward<Tf>(_function));
+		}
+		
+		/** @see Hashmap::Remove(const Tk&) */
+		bool Remove(const Tk& _key) noexcept {
+			return Shard(_key).Remove(_key);
+		}
+		
+		/** @see Hashmap::Remove(const Tk&, std::exception_ptr&) */
+		bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+			return Shard(_key).Remove(_key, _exception);
+		}
+		
+		/** @see Hashmap::Get(const Tk&) */
+		optional_ref Get(const Tk& _key) const noexcept {
+			return Shard(_key).Get(_key);
+		}
+		
+		/** @see Hashmap::Get(const Tk&, std::exception_ptr&) */
+		optional_ref Get(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			return Shard(_key).Get(_key, _exception);
+		}
+		
+		/** @see Hashmap::Find(const Tk&, ConstAccessor&) */
+		bool Find(const Tk& _key, ConstAccessor& _accessor) const noexcept {
+			return Shard(_key).Find(_key, _accessor);
+		}
+		
+		/** @see Hashmap::Find(const Tk&, Accessor&) */
+		bool Find(const Tk& _key, Accessor& _accessor) noexcept {
+			return Shard(_key).Find(_key, _accessor);
+		}
+		
+		/** @see Hashmap::Insert(const Tk&, const Tv&, Accessor&) */
+		bool Insert(const Tk& _key, const Tv& _value, Accessor& _accessor) noexcept {
+			return Shard(_key).Insert(_key, _value, _accessor);
+		}
+		
+		/**
+		 * @brief Reduces the capacity of every shard to fit the number of entries it contains.
+		 */
+		void Trim() {
+			
+			for (auto& shard : m_Shards) {
+				shard.m_Map.Trim();
+			}
+		}
+		
+		/**
+		 * @brief Reserves memory for the container to have a minimum capacity of _newSize elements, divided evenly between the shards.
+		 *
+		 * @param[in] _newSize The minimum capacity to reserve for the container.
+		 */
+		void Reserve(const std::size_t& _newSize) {
+			
+			for (auto& shard : m_Shards) {
+				shard.m_Map.Reserve((_newSize + N - 1U) / N);
+			}
+		}
+		
+		/**
+		 * @brief Clears all entries from every shard.
+		 */
+		void Clear() noexcept {
+			
+			for (auto& shard : m_Shards) {
+				shard.m_Map.Clear();
+			}
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all keys stored within the ShardedHashmap.
+		 * @return A shallow copy of all keys stored within the ShardedHashmap.
+		 */
+		[[nodiscard]] std::vector<Tk> Keys() const {
+			
+			std::vector<Tk> result;
+			
+			for (const auto& shard : m_Shards) {
+				
+				auto keys = shard.m_Map.Keys();
+				
+				result.insert(result.end(), std::make_move_iterator(keys.begin()), std::make_move_iterator(keys.end()));
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all values stored within the ShardedHashmap.
+		 * @return A shallow copy of all values stored within the ShardedHashmap.
+		 */
+		[[nodiscard]] std::vector<Tv> Values() const {
+			
+			std::vector<Tv> result;
+			
+			for (const auto& shard : m_Shards) {
+				
+				auto values = shard.m_Map.Values();
+				
+				result.insert(result.end(), std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all entries stored within the ShardedHashmap.
+		 * @return A shallow copy of all entries stored within the ShardedHashmap.
+		 */
+		[[nodiscard]] std::vector<KeyValuePair> GetAll() const {
+			
+			std::vector<KeyValuePair> result;
+			
+			for (const auto& shard : m_Shards) {
+				
+				auto all = shard.m_Map.GetAll();
+				
+				result.insert(result.end(), std::make_move_iterator(all.begin()), std::make_move_iterator(all.end()));
+			}
+			
+			return result;
+		}
+		
+		/* ITERATORS */
+		
+		/**
+		 * @class const_iterator
+		 * @brief Represents an iterator to traverse through the elements of every shard in a ShardedHashmap.
+		 */
+		class const_iterator final {
+			
+			friend ShardedHashmap;
+			
+			using outer_itr = typename std::array<PaddedShard, N>::const_iterator;
+			using inner_itr = typename shard_t::const_iterator;
+		
+		private:
+		
+			outer_itr m_Outer;
+			outer_itr m_Outer_End;
+			inner_itr m_Inner;
+			
+			const_iterator(const outer_itr& _outer,
+			               const outer_itr& _outer_end,
+			               const inner_itr& _inner) :
+				    m_Outer(_outer),
+				m_Outer_End(_outer_end),
+				    m_Inner(_inner)
+			{
+				Skip();
+			}
+			
+			/** @brief Advances to the next shard until a non-exhausted one is found. */
+			void Skip() {
+				
+				while (m_Outer != m_Outer_End && m_Inner == m_Outer->m_Map.end()) {
+					
+					if (++m_Outer != m_Outer_End) {
+						m_Inner = m_Outer->m_Map.begin();
+					}
+				}
+			}
+		
+		public:
+		
+			const const_iterator& operator ++() {
+				
+				++m_Inner;
+				
+				Skip();
+				
+				return *this;
+			}
+			
+			const KeyValuePair& operator *() const { return *m_Inner; }
+			
+			bool operator ==(const const_iterator& other) const { return ((m_Outer == other.m_Outer) && (m_Outer == m_Outer_End || m_Inner == other.m_Inner)); }
+			bool operator !=(const const_iterator& other) const { return !operator ==(other); }
+		};
+		
+		const_iterator begin() const { return const_iterator(m_Shards.begin(), m_Shards.end(), m_Shards.begin()->m_Map.begin()); }
+		const_iterator   end() const { return const_iterator(m_Shards.end(),   m_Shards.end(), m_Shards.begin()->m_Map.end()); }
+	};
+
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_SHARDEDHASHMAP_HPP
@@ -0,0 +1,473 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef LOUIERIKSSON_SMALLHASHMAP_HPP
+#define LOUIERIKSSON_SMALLHASHMAP_HPP
+
+#include "Hashmap.hpp"
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @brief A Hashmap which stores up to N entries inline, upgrading to a Hashmap once it grows beyond them.
+	 * @details While small, entries are packed into inline storage and found by a linear scan of a contiguous array of their hashcodes,
+	 *          so a small map performs no allocation and touches at most two cache lines per lookup. Once an insertion would exceed N entries,
+	 *          the entries are copied into a Hashmap, to which every subsequent operation is forwarded. The map does not return to inline storage,
+	 *          except when cleared. As with Hashmap, keys are compared by hashcode.
+	 *
+	 * @tparam Tk Key type of the SmallHashmap.
+	 * @tparam Tv Value type of the SmallHashmap.
+	 * @tparam N Number of entries stored inline.
+	 * @tparam TPolicy Configuration of the Hashmap used once the map grows beyond N entries. See HashmapPolicy.
+	 */
+	template<typename Tk, typename Tv, size_t N = 8U, typename TPolicy = HashmapPolicy>
+	class SmallHashmap final {
+		
+		static_assert(N > 0U, "The SmallHashmap requires an inline capacity of at least one entry.");
+		
+	public:
+		
+		using table_t = Hashmap<Tk, Tv, TPolicy>;
+		
+		using KeyValuePair = typename table_t::KeyValuePair;
+		
+	private:
+		
+		/**
+		 * @brief Guards the inline entries, and the transition to the table.
+		 * @details Once the table exists, it is only acquired in shared mode, leaving the table's own stripes to order its writers.
+		 */
+		mutable std::shared_mutex m_Lock;
+		
+		/** @brief The table, or nullptr while the entries are stored inline. */
+		std::unique_ptr<table_t> m_Table;
+		
+		size_t m_Count { 0U };
+		
+		/** @brief Hashcodes of the inline entries, kept apart from the entries so that a scan reads only hashcodes. */
+		std::array<size_t, N> m_Hashes {};
+		
+		alignas(KeyValuePair) unsigned char m_Storage[sizeof(KeyValuePair) * N];
+		
+		KeyValuePair& Entry(const size_t& _index) noexcept {
+			return *std::launder(reinterpret_cast<KeyValuePair*>(m_Storage) + _index);
+		}
+		
+		const KeyValuePair& Entry(const size_t& _index) const noexcept {
+			return *std::launder(reinterpret_cast<const KeyValuePair*>(m_Storage) + _index);
+		}
+		
+		/**
+		 * @brief Calculates the hashcode of a given key.
+		 * @param[in] _item Key to calculate the hash of.
+		 * @return Hashcode of _item.
+		 */
+		static constexpr size_t GetHashcode(const Tk& _item) {
+			return std::hash<Tk>()(_item);
+		}
+		
+		/**
+		 * @brief Finds the inline entry with the given hashcode. The caller must hold the lock.
+		 * @param[in] _hash Hashcode of the key.
+		 * @return Index of the entry, or N if no entry exists.
+		 */
+		size_t Locate(const size_t& _hash) const noexcept {
+			
+			auto result = N;
+			
+			for (size_t i = 0U; i < m_Count; ++i) {
+				
+				if (m_Hashes[i] == _hash) {
+					result = i;
+					
+					break;
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Copies the inline entries into a new table, and releases them. The caller must hold the lock exclusively.
+		 * @details If an exception is thrown, the entries remain inline.
+		 */
+		void Upgrade() {
+			
+			auto table = std::make_unique<table_t>(N * 2U);
+			
+			for (size_t i = 0U; i < m_Count; ++i) {
+				
+				std::exception_ptr exception;
+				
+				table->Add(Entry(i).first, Entry(i).second, exception);
+				
+				if (exception) {
+					std::rethrow_exception(exception);
+				}
+			}
+			
+			Destroy();
+			
+			m_Table = std::move(table);
+		}
+		
+		/** @brief Destroys every inline entry. The caller must hold the lock exclusively. */
+		void Destroy() noexcept {
+			
+			for (size_t i = 0U; i < m_Count; ++i) {
+				Entry(i).~KeyValuePair();
+			}
+			
+			m_Count = 0U;
+		}
+		
+		/**
+		 * @brief Applies an operation to the table if one exists, otherwise to the inline entries while holding the lock exclusively.
+		 * @param[in] _table Operation to apply to the table.
+		 * @param[in] _inline Operation to apply to the inline entries.
+		 * @return The result of the operation.
+		 */
+		template<typename Tt, typename Ti>
+		auto Write(Tt&& _table, Ti&& _inline) {
+			
+			{
+				const std::shared_lock lock(m_Lock);
+				
+				if (m_Table != nullptr) {
+					return _table(*m_Table);
+				}
+			}
+			
+			const std::unique_lock lock(m_Lock);
+			
+			// Another writer may have upgraded the map while the lock was released.
+			return m_Table != nullptr ? _table(*m_Table) : _inline();
+		}
+		
+		/**
+		 * @brief Inserts or replaces the entry with the given key. The caller must hold the lock exclusively, and the entries must be inline.
+		 * @details If an exception is thrown, the SmallHashmap is left unchanged.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[in] _replace Whether to replace the value of an existing entry.
+		 * @return True if an entry was inserted or replaced, false otherwise.
+		 */
+		bool Store(const Tk& _key, const Tv& _value, const bool& _replace) {
+			
+			auto result = false;
+			
+			const auto hash  = GetHashcode(_key);
+			const auto found = Locate(hash);
+			
+			if (found != N) {
+				
+				if (_replace) {
+					Entry(found).second = _value;
+					
+					result = true;
+				}
+			}
+			else if (m_Count < N) {
+				
+				::new (static_cast<void*>(&Entry(m_Count))) KeyValuePair(_key, _value);
+				
+				m_Hashes[m_Count++] = hash;
+				
+				result = true;
+			}
+			else {
+				
+				Upgrade();
+				
+				std::exception_ptr exception;
+				
+				if (_replace) {
+					m_Table->Assign(_key, _value, exception);
+					
+					result = exception == nullptr;
+				}
+				else {
+					result = m_Table->Add(_key, _value, exception);
+				}
+				
+				if (exception) {
+					std::rethrow_exception(exception);
+				}
+			}
+			
+			return result;
+		}
+		
+	public:
+		
+		SmallHashmap() noexcept = default;
+		
+		SmallHashmap(const SmallHashmap&) = delete;
+		SmallHashmap& operator = (const SmallHashmap&) = delete;
+		
+		~SmallHashmap() {
+			Destroy();
+		}
+		
+		/** @brief Returns the number of entries in the SmallHashmap. */
+		[[nodiscard]] size_t size() const noexcept {
+			
+			const std::shared_lock lock(m_Lock);
+			
+			return m_Table != nullptr ? m_Table->size() : m_Count;
+		}
+		
+		[[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+		
+		/**
+		 * @brief Determines whether the entries are stored inline.
+		 * @return True if the map has not grown beyond N entries since it was constructed or last cleared, false otherwise.
+		 */
+		[[nodiscard]] bool IsInline() const noexcept {
+			
+			const std::shared_lock lock(m_Lock);
+			
+			return m_Table == nullptr;
+		}
+		
+		/**
+		 * @brief Determines whether the SmallHashmap contains the given key.
+		 *
+		 * @param[in] _key Key to check for.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if the key exists, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const std::shared_lock lock(m_Lock);
+				
+				result = m_Table != nullptr ?
+					m_Table->ContainsKey(_key, _exception) :
+					Locate(GetHashcode(_key)) != N;
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc ContainsKey(const Tk&, std::exception_ptr&) const */
+		bool ContainsKey(const Tk& _key) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return ContainsKey(_key, exception);
+		}
+		
+		/**
+		 * @brief Inserts a new entry with the given key and value, if one does not already exist.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				result = Write(
+					[&](table_t& _table) { return _table.Add(_key, _value, _exception); },
+					[&]() { return Store(_key, _value, false); }
+				);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Add(const Tk&, const Tv&, std::exception_ptr&) */
+		bool Add(const Tk& _key, const Tv& _value) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Add(_key, _value, exception);
+		}
+		
+		/**
+		 * @brief Inserts or replaces the entry with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 */
+		void Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			try {
+				Write(
+					[&](table_t& _table) { _table.Assign(_key, _value, _exception); return true; },
+					[&]() { return Store(_key, _value, true); }
+				);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+		}
+		
+		/** @copydoc Assign(const Tk&, const Tv&, std::exception_ptr&) */
+		void Assign(const Tk& _key, const Tv& _value) noexcept {
+			
+			std::exception_ptr exception;
+			
+			Assign(_key, _value, exception);
+		}
+		
+		/**
+		 * @brief Removes the entry with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if an entry was removed, false otherwise.
+		 */
+		bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				result = Write(
+					[&](table_t& _table) { return _table.Remove(_key, _exception); },
+					[&]() {
+						
+						const auto index = Locate(GetHashcode(_key));
+						
+						if (index != N) {
+							
+							// Keep the entries packed by moving the last entry into the vacated position.
+							if (index != m_Count - 1U) {
+								Entry(index)    = std::move(Entry(m_Count - 1U));
+								m_Hashes[index] = m_Hashes[m_Count - 1U];
+							}
+							
+							Entry(--m_Count).~KeyValuePair();
+						}
+						
+						return index != N;
+					}
+				);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Remove(const Tk&, std::exception_ptr&) */
+		bool Remove(const Tk& _key) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Remove(_key, exception);
+		}
+		
+		/**
+		 * @brief Retrieves a copy of the value associated with the given key.
+		 * @details A copy is returned, rather than a reference, as the inline entries move when others are removed.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return The value, or std::nullopt if the key is not present.
+		 */
+		std::optional<Tv> Get(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			std::optional<Tv> result;
+			
+			try {
+				
+				const std::shared_lock lock(m_Lock);
+				
+				if (m_Table != nullptr) {
+					
+					typename table_t::ConstAccessor accessor;
+					
+					if (m_Table->Find(_key, accessor, _exception)) {
+						result.emplace(accessor.value());
+					}
+				}
+				else {
+					
+					const auto index = Locate(GetHashcode(_key));
+					
+					if (index != N) {
+						result.emplace(Entry(index).second);
+					}
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Get(const Tk&, std::exception_ptr&) const */
+		std::optional<Tv> Get(const Tk& _key) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Get(_key, exception);
+		}
+		
+		/**
+		 * @brief Clears all entries from the SmallHashmap, returning it to inline storage.
+		 */
+		void Clear() noexcept {
+			
+			const std::unique_lock lock(m_Lock);
+			
+			Destroy();
+			
+			m_Table.reset();
+		}
+	};
+	
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_SMALLHASHMAP_HPP
@@ -0,0 +1,647 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef LOUIERIKSSON_SOAHASHMAP_HPP
+#define LOUIERIKSSON_SOAHASHMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @brief A Hashmap which stores its hashcodes, keys and values in separate arrays (a structure of arrays).
+	 * @details Entries are found through an open-addressed index, probed linearly, whose slots pack a 32-bit fingerprint of the hashcode alongside
+	 *          the entry's position. A lookup therefore probes only the compact index, confirms a matching fingerprint against the array of hashcodes,
+	 *          and touches the value only once the entry has been found, so large values are never dragged into the cache while probing.
+	 *          The keys, which Hashmap compares by hashcode, are only read when copied out.
+	 *          The arrays are kept dense by moving the last entry into the position of a removed one, and the index is kept free of tombstones
+	 *          by shifting displaced slots back on removal.
+	 *
+	 * @tparam Tk Key type of the SoAHashmap.
+	 * @tparam Tv Value type of the SoAHashmap.
+	 */
+	template<typename Tk, typename Tv>
+	class SoAHashmap final {
+		
+	private:
+		
+		/** @brief Value of an empty slot of the index. */
+		static constexpr uint64_t s_Empty = 0U;
+		
+		/** @brief Minimum number of slots of the index. */
+		static constexpr size_t s_MinimumCapacity = 16U;
+		
+		mutable std::shared_mutex m_Lock;
+		
+		std::vector<size_t> m_Hashes;
+		std::vector<Tk>     m_Keys;
+		std::vector<Tv>     m_Values;
+		
+		/** @brief Fingerprint of each entry in the upper 32 bits, and its position plus one in the lower 32 bits, or s_Empty. Its size is always a power of two. */
+		std::vector<uint64_t> m_Index;
+		
+		/**
+		 * @brief Calculates the hashcode of a given key.
+		 * @param[in] _item Key to calculate the hash of.
+		 * @return Hashcode of _item.
+		 */
+		static constexpr size_t GetHashcode(const Tk& _item) {
+			return std::hash<Tk>()(_item);
+		}
+		
+		/**
+		 * @brief Mixes a hashcode by Fibonacci hashing, as the index is a power of two in size and std::hash is often the identity.
+		 * @param[in] _hash Hashcode of the key.
+		 * @return The mixed hashcode, whose lower bits select the home slot and whose upper bits form the fingerprint.
+		 */
+		static constexpr uint64_t Mix(const size_t& _hash) noexcept {
+			return static_cast<uint64_t>(_hash) * 0x9E3779B97F4A7C15ULL;
+		}
+		
+		/**
+		 * @brief Returns the home slot of a hashcode.
+		 * @param[in] _hash Hashcode of the key.
+		 * @return Index of the slot.
+		 */
+		size_t Home(const size_t& _hash) const noexcept {
+			return static_cast<size_t>(Mix(_hash) >> 16U) & (m_Index.size() - 1U);
+		}
+		
+		/**
+		 * @brief Packs the fingerprint of a hashcode with a position.
+		 * @param[in] _hash Hashcode of the key.
+		 * @param[in] _position Position of the entry.
+		 * @return The slot.
+		 */
+		static constexpr uint64_t Pack(const size_t& _hash, const size_t& _position) noexcept {
+			return (Mix(_hash) & 0xFFFFFFFF00000000ULL) | static_cast<uint64_t>(_position + 1U);
+		}
+		
+		/**
+		 * @brief Finds the slot of the index referring to the entry with the given hashcode. The caller must hold the lock.
+		 * @param[in] _hash Hashcode of the key.
+		 * @return Index of the slot, or the size of the index if no entry exists.
+		 */
+		size_t Locate(const size_t& _hash) const noexcept {
+			
+			auto result = m_Index.size();
+			
+			if (!m_Index.empty()) {
+				
+				const auto fingerprint = Pack(_hash, 0U) & 0xFFFFFFFF00000000ULL;
+				
+				for (auto slot = Home(_hash); m_Index[slot] != s_Empty; slot = (slot + 1U) & (m_Index.size() - 1U)) {
+					
+					const auto packed = m_Index[slot];
+					
+					// Only consult the array of hashcodes once the fingerprints match.
+					if ((packed & 0xFFFFFFFF00000000ULL) == fingerprint && m_Hashes[(packed & 0xFFFFFFFFULL) - 1U] == _hash) {
+						result = slot;
+						
+						break;
+					}
+				}
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Returns the position of the entry referred to by a slot of the index.
+		 * @param[in] _slot Index of the slot.
+		 * @return Position of the entry.
+		 */
+		size_t PositionOf(const size_t& _slot) const noexcept {
+			return static_cast<size_t>(m_Index[_slot] & 0xFFFFFFFFULL) - 1U;
+		}
+		
+		/**
+		 * @brief Rebuilds the index with the given number of slots. The caller must hold the lock exclusively.
+		 * @details If an exception is thrown, the SoAHashmap is left unchanged.
+		 * @param[in] _capacity Number of slots of the new index. Must be a power of two greater than the number of entries.
+		 */
+		void Rebuild(const size_t& _capacity) {
+			
+			std::vector<uint64_t> index(_capacity, s_Empty);
+			
+			m_Index.swap(index);
+			
+			for (size_t i = 0U; i < m_Hashes.size(); ++i) {
+				
+				auto slot = Home(m_Hashes[i]);
+				
+				while (m_Index[slot] != s_Empty) {
+					slot = (slot + 1U) & (m_Index.size() - 1U);
+				}
+				
+				m_Index[slot] = Pack(m_Hashes[i], i);
+			}
+		}
+		
+		/**
+		 * @brief Returns the number of slots of the index needed for a number of entries.
+		 * @param[in] _count Number of entries.
+		 * @return The smallest power of two which is at least twice _count, and at least s_MinimumCapacity.
+		 */
+		static size_t CapacityFor(const size_t& _count) noexcept {
+			
+			auto result = s_MinimumCapacity;
+			
+			while (result < _count * 2U) {
+				result *= 2U;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Inserts or replaces the entry with the given key. The caller must hold the lock exclusively.
+		 * @details If an exception is thrown, the SoAHashmap is left unchanged.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[in] _replace Whether to replace the value of an existing entry.
+		 * @return True if an entry was inserted or replaced, false otherwise.
+		 */
+		bool Store(const Tk& _key, const Tv& _value, const bool& _replace) {
+			
+			auto result = false;
+			
+			const auto hash  = GetHashcode(_key);
+			const auto found = Locate(hash);
+			
+			if (found != m_Index.size()) {
+				
+				if (_replace) {
+					m_Values[PositionOf(found)] = _value;
+					
+					result = true;
+				}
+			}
+			else {
+				
+				if (m_Hashes.size() >= UINT32_MAX - 1U) {
+					throw std::length_error("The SoAHashmap cannot hold any more entries.");
+				}
+				
+				// Keep the index at most half full.
+				if ((m_Hashes.size() + 1U) * 2U > m_Index.size()) {
+					Rebuild(CapacityFor(m_Hashes.size() + 1U));
+				}
+				
+				m_Values.push_back(_value);
+				
+				try {
+					m_Keys.push_back(_key);
+					
+					try {
+						m_Hashes.push_back(hash);
+					}
+					catch (...) {
+						m_Keys.pop_back();
+						
+						throw;
+					}
+				}
+				catch (...) {
+					m_Values.pop_back();
+					
+					throw;
+				}
+				
+				auto slot = Home(hash);
+				
+				while (m_Index[slot] != s_Empty) {
+					slot = (slot + 1U) & (m_Index.size() - 1U);
+				}
+				
+				m_Index[slot] = Pack(hash, m_Hashes.size() - 1U);
+				
+				result = true;
+			}
+			
+			return result;
+		}
+		
+		/**
+		 * @brief Removes the entry referred to by a slot of the index. The caller must hold the lock exclusively.
+		 * @param[in] _slot Index of the slot.
+		 */
+		void Erase(size_t _slot) noexcept {
+			
+			const auto position = PositionOf(_slot);
+			const auto last     = m_Hashes.size() - 1U;
+			
+			// Shift back any following slots displaced from their home, so that the index needs no tombstones.
+			m_Index[_slot] = s_Empty;
+			
+			for (auto next = (_slot + 1U) & (m_Index.size() - 1U); m_Index[next] != s_Empty; next = (next + 1U) & (m_Index.size() - 1U)) {
+				
+				const auto home = Home(m_Hashes[PositionOf(next)]);
+				
+				const auto stays = _slot <= next ?
+					(home > _slot && home <= next) :
+					(home > _slot || home <= next);
+				
+				if (!stays) {
+					m_Index[_slot] = m_Index[next];
+					m_Index[next]  = s_Empty;
+					
+					_slot = next;
+				}
+			}
+			
+			// Keep the arrays dense by moving the last entry into the vacated position.
+			if (position != last) {
+				
+				m_Index[Locate(m_Hashes[last])] = Pack(m_Hashes[last], position);
+				
+				m_Hashes[position] = m_Hashes[last];
+				m_Keys  [position] = std::move(m_Keys  [last]);
+				m_Values[position] = std::move(m_Values[last]);
+			}
+			
+			m_Hashes.pop_back();
+			m_Keys.pop_back();
+			m_Values.pop_back();
+		}
+		
+	public:
+		
+		/**
+		 * @class ConstAccessor
+		 * @brief Provides read-only access to an entry of the SoAHashmap while holding a shared lock.
+		 * @details The lock is held until the accessor is released or destroyed, so the referenced entry cannot be modified or relocated in the meantime.
+		 *          Writing to the SoAHashmap from the thread holding the accessor will deadlock.
+		 */
+		class ConstAccessor final {
+			
+			friend SoAHashmap;
+			
+		private:
+			
+			std::shared_lock<std::shared_mutex> m_Lock;
+			
+			const Tk* m_Key;
+			const Tv* m_Value;
+			
+		public:
+			
+			ConstAccessor() noexcept :
+				  m_Key(nullptr),
+				m_Value(nullptr) {}
+			
+			ConstAccessor(const ConstAccessor& _other) = delete;
+			ConstAccessor& operator = (const ConstAccessor& _other) = delete;
+			
+			ConstAccessor(ConstAccessor&& _rhs) noexcept = default;
+			ConstAccessor& operator = (ConstAccessor&& _rhs) noexcept = default;
+			
+			/** @brief Releases the lock and detaches the accessor from its entry. */
+			void release() noexcept {
+				
+				  m_Key = nullptr;
+				m_Value = nullptr;
+				
+				if (m_Lock.owns_lock()) {
+					m_Lock.unlock();
+				}
+			}
+			
+			[[nodiscard]] bool empty() const noexcept { return m_Value == nullptr; }
+			
+			[[nodiscard]] const Tk&   key() const { return *m_Key;   }
+			[[nodiscard]] const Tv& value() const { return *m_Value; }
+			
+			[[nodiscard]] const Tv& operator  *() const { return  value(); }
+			[[nodiscard]] const Tv* operator ->() const { return &value(); }
+			
+			[[nodiscard]] operator bool() const noexcept { return !empty(); }
+		};
+		
+		SoAHashmap() noexcept = default;
+		
+		SoAHashmap(const SoAHashmap&) = delete;
+		SoAHashmap& operator = (const SoAHashmap&) = delete;
+		
+		/** @brief Returns the number of entries in the SoAHashmap. */
+		[[nodiscard]] size_t size() const noexcept {
+			
+			const std::shared_lock lock(m_Lock);
+			
+			return m_Hashes.size();
+		}
+		
+		[[nodiscard]] bool empty() const noexcept { return size() == 0U; }
+		
+		/**
+		 * @brief Determines whether the SoAHashmap contains the given key.
+		 *
+		 * @param[in] _key Key to check for.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if the key exists, false otherwise.
+		 */
+		bool ContainsKey(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				const std::shared_lock lock(m_Lock);
+				
+				result = Locate(hash) != m_Index.size();
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc ContainsKey(const Tk&, std::exception_ptr&) const */
+		bool ContainsKey(const Tk& _key) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return ContainsKey(_key, exception);
+		}
+		
+		/**
+		 * @brief Inserts a new entry with the given key and value, if one does not already exist.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if successful, false otherwise.
+		 */
+		bool Add(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const std::unique_lock lock(m_Lock);
+				
+				result = Store(_key, _value, false);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Add(const Tk&, const Tv&, std::exception_ptr&) */
+		bool Add(const Tk& _key, const Tv& _value) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Add(_key, _value, exception);
+		}
+		
+		/**
+		 * @brief Inserts or replaces the entry with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[in] _value Value of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 */
+		void Assign(const Tk& _key, const Tv& _value, std::exception_ptr& _exception) noexcept {
+			
+			try {
+				
+				const std::unique_lock lock(m_Lock);
+				
+				Store(_key, _value, true);
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+		}
+		
+		/** @copydoc Assign(const Tk&, const Tv&, std::exception_ptr&) */
+		void Assign(const Tk& _key, const Tv& _value) noexcept {
+			
+			std::exception_ptr exception;
+			
+			Assign(_key, _value, exception);
+		}
+		
+		/**
+		 * @brief Removes the entry with the given key.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if an entry was removed, false otherwise.
+		 */
+		bool Remove(const Tk& _key, std::exception_ptr& _exception) noexcept {
+			
+			auto result = false;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				const std::unique_lock lock(m_Lock);
+				
+				const auto slot = Locate(hash);
+				
+				if (slot != m_Index.size()) {
+					Erase(slot);
+					
+					result = true;
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Remove(const Tk&, std::exception_ptr&) */
+		bool Remove(const Tk& _key) noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Remove(_key, exception);
+		}
+		
+		/**
+		 * @brief Retrieves a copy of the value associated with the given key.
+		 * @details To read a large value without copying it, use Find() with an accessor.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return The value, or std::nullopt if the key is not present.
+		 */
+		std::optional<Tv> Get(const Tk& _key, std::exception_ptr& _exception) const noexcept {
+			
+			std::optional<Tv> result;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				const std::shared_lock lock(m_Lock);
+				
+				const auto slot = Locate(hash);
+				
+				if (slot != m_Index.size()) {
+					result.emplace(m_Values[PositionOf(slot)]);
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Get(const Tk&, std::exception_ptr&) const */
+		std::optional<Tv> Get(const Tk& _key) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Get(_key, exception);
+		}
+		
+		/**
+		 * @brief Acquires read-only access to the entry with the given key.
+		 * @details On success, the accessor holds a shared lock on the SoAHashmap until it is released or destroyed.
+		 *          Any entry previously held by the accessor is released first.
+		 *
+		 * @param[in] _key Key of the entry.
+		 * @param[out] _accessor Accessor to attach to the entry.
+		 * @param[out] _exception (optional) A pointer to any exception caught during the operation.
+		 * @return True if the entry exists, false otherwise.
+		 */
+		bool Find(const Tk& _key, ConstAccessor& _accessor, std::exception_ptr& _exception) const noexcept {
+			
+			_accessor.release();
+			
+			auto result = false;
+			
+			try {
+				
+				const auto hash = GetHashcode(_key);
+				
+				std::shared_lock lock(m_Lock);
+				
+				const auto slot = Locate(hash);
+				
+				if (slot != m_Index.size()) {
+					
+					const auto position = PositionOf(slot);
+					
+					_accessor.m_Lock  = std::move(lock);
+					_accessor.m_Key   = &m_Keys[position];
+					_accessor.m_Value = &m_Values[position];
+					
+					result = true;
+				}
+			}
+			catch (...) {
+				_exception = std::current_exception();
+			}
+			
+			return result;
+		}
+		
+		/** @copydoc Find(const Tk&, ConstAccessor&, std::exception_ptr&) const */
+		bool Find(const Tk& _key, ConstAccessor& _accessor) const noexcept {
+			
+			std::exception_ptr exception;
+			
+			return Find(_key, _accessor, exception);
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all keys stored within the SoAHashmap.
+		 * @return A shallow copy of all keys stored within the SoAHashmap.
+		 */
+		[[nodiscard]] std::vector<Tk> Keys() const {
+			
+			const std::shared_lock lock(m_Lock);
+			
+			return m_Keys;
+		}
+		
+		/**
+		 * @brief Returns a shallow copy of all values stored within the SoAHashmap.
+		 * @return A shallow copy of all values stored within the SoAHashmap.
+		 */
+		[[nodiscard]] std::vector<Tv> Values() const {
+			
+			const std::shared_lock lock(m_Lock);
+			
+			return m_Values;
+		}
+		
+		/**
+		 * @brief Reserves memory for the SoAHashmap to hold at least _newSize entries without growing.
+		 * @param[in] _newSize The minimum number of entries to reserve memory for.
+		 */
+		void Reserve(const size_t& _newSize) {
+			
+			const std::unique_lock lock(m_Lock);
+			
+			m_Hashes.reserve(_newSize);
+			m_Keys.reserve(_newSize);
+			m_Values.reserve(_newSize);
+			
+			if (CapacityFor(_newSize) > m_Index.size()) {
+				Rebuild(CapacityFor(_newSize));
+			}
+		}
+		
+		/**
+		 * @brief Clears all entries from the SoAHashmap.
+		 */
+		void Clear() noexcept {
+			
+			const std::unique_lock lock(m_Lock);
+			
+			m_Hashes.clear();
+			m_Keys.clear();
+			m_Values.clear();
+			m_Index.clear();
+		}
+	};
+	
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_SOAHASHMAP_HPP
@@ -0,0 +1,244 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Louis Eriksson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef LOUIERIKSSON_STATICHASHMAP_HPP
+#define LOUIERIKSSON_STATICHASHMAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace LouiEriksson {
+	
+	/**
+	 * @brief Hash function usable in constant expressions, as required by StaticHashmap.
+	 * @details Specialise this struct to use your own key types with a StaticHashmap.
+	 * @tparam T Type to hash.
+	 */
+	template<typename T, typename = void>
+	struct StaticHash;
+	
+	/** @brief Hashes integers and enumerations by mixing their bits (the finaliser of MurmurHash3). */
+	template<typename T>
+	struct StaticHash<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>> {
+		
+		constexpr size_t operator()(const T& _value) const noexcept {
+			
+			auto result = static_cast<uint64_t>(_value);
+			
+			result ^= result >> 33U;
+			result *= 0xFF51AFD7ED558CCDULL;
+			result ^= result >> 33U;
+			result *= 0xC4CEB9FE1A85EC53ULL;
+			result ^= result >> 33U;
+			
+			return static_cast<size_t>(result);
+		}
+	};
+	
+	/** @brief Hashes strings with 64-bit FNV-1a. */
+	template<>
+	struct StaticHash<std::string_view> {
+		
+		constexpr size_t operator()(const std::string_view& _value) const noexcept {
+			
+			uint64_t result = 0xCBF29CE484222325ULL;
+			
+			for (const auto& character : _value) {
+				result ^= static_cast<unsigned char>(character);
+				result *= 0x100000001B3ULL;
+			}
+			
+			return static_cast<size_t>(result);
+		}
+	};
+	
+	/**
+	 * @brief An immutable map with fixed storage, which can be built entirely at compile time.
+	 * @details Entries are stored inline, in the order given, alongside an open-addressed index of at least twice as many slots, probed linearly.
+	 *          Unlike Hashmap, keys are compared by value once their hashcodes match, as lookups are often made with arbitrary keys (such as identifiers being parsed).
+	 *          The key and value types must be literal and default-constructible; use std::string_view rather than std::string for text.
+	 *
+	 * @code
+	 * constexpr auto keywords = LouiEriksson::MakeStaticHashmap<std::string_view, int>({
+	 *     { "if",    0 },
+	 *     { "else",  1 },
+	 *     { "while", 2 }
+	 * });
+	 *
+	 * static_assert(keywords.Get("else").value() == 1);
+	 * @endcode
+	 *
+	 * @tparam Tk Key type of the StaticHashmap.
+	 * @tparam Tv Value type of the StaticHashmap.
+	 * @tparam N Number of entries.
+	 * @tparam THash Hash function usable in constant expressions. See StaticHash.
+	 */
+	template<typename Tk, typename Tv, size_t N, typename THash = StaticHash<Tk>>
+	class StaticHashmap final {
+		
+		/**
+		 * @brief Returns the number of slots in the index for a given number of entries.
+		 * @param[in] _count Number of entries.
+		 * @return The smallest power of two which is at least twice _count.
+		 */
+		static constexpr size_t Capacity(const size_t& _count) noexcept {
+			
+			size_t result = 1U;
+			
+			while (result < _count * 2U) {
+				result *= 2U;
+			}
+			
+			return result;
+		}
+		
+		/** @brief Number of slots in the index. */
+		static constexpr size_t s_Capacity = Capacity(N);
+		
+		std::array<Tk, N> m_Keys {};
+		std::array<Tv, N> m_Values {};
+		
+		std::array<size_t, N> m_Hashes {};
+		
+		/** @brief Index of the entry occupying each slot, plus one. Zero indicates an empty slot. */
+		std::array<size_t, s_Capacity> m_Slots {};
+		
+		/**
+		 * @brief Finds the entry with the given key.
+		 * @param[in] _key Key of the entry.
+		 * @return Index of the entry, or N if no entry exists.
+		 */
+		constexpr size_t Locate(const Tk& _key) const {
+			
+			auto result = N;
+			
+			const auto hash = THash()(_key);
+			
+			for (auto slot = hash & (s_Capacity - 1U); m_Slots[slot] != 0U; slot = (slot + 1U) & (s_Capacity - 1U)) {
+				
+				const auto index = m_Slots[slot] - 1U;
+				
+				if (m_Hashes[index] == hash && m_Keys[index] == _key) {
+					result = index;
+					
+					break;
+				}
+			}
+			
+			return result;
+		}
+		
+	public:
+		
+		/**
+		 * @brief Constructs a StaticHashmap from a list of entries.
+		 * @param[in] _entries Entries of the StaticHashmap.
+		 * @throw std::invalid_argument If a key occurs more than once. When evaluated at compile time, this is a compilation error.
+		 */
+		constexpr explicit StaticHashmap(const std::pair<Tk, Tv> (&_entries)[N]) {
+			
+			for (size_t i = 0U; i < N; ++i) {
+				
+				m_Keys[i]   = _entries[i].first;
+				m_Values[i] = _entries[i].second;
+				m_Hashes[i] = THash()(_entries[i].first);
+				
+				if (Locate(m_Keys[i]) != N) {
+					throw std::invalid_argument("Duplicate key in StaticHashmap.");
+				}
+				
+				auto slot = m_Hashes[i] & (s_Capacity - 1U);
+				
+				while (m_Slots[slot] != 0U) {
+					slot = (slot + 1U) & (s_Capacity - 1U);
+				}
+				
+				m_Slots[slot] = i + 1U;
+			}
+		}
+		
+		[[nodiscard]] constexpr size_t size() const noexcept { return N; }
+		
+		[[nodiscard]] constexpr bool empty() const noexcept { return N == 0U; }
+		
+		/**
+		 * @brief Determines whether the StaticHashmap contains the given key.
+		 * @param[in] _key Key to check for.
+		 * @return True if the key exists, false otherwise.
+		 */
+		constexpr bool ContainsKey(const Tk& _key) const {
+			return Locate(_key) != N;
+		}
+		
+		/**
+		 * @brief Retrieves the value associated with the given key.
+		 * @param[in] _key Key of the entry.
+		 * @return A copy of the value, or std::nullopt if the key is not present.
+		 */
+		constexpr std::optional<Tv> Get(const Tk& _key) const {
+			
+			std::optional<Tv> result;
+			
+			const auto index = Locate(_key);
+			
+			if (index != N) {
+				result = m_Values[index];
+			}
+			
+			return result;
+		}
+		
+		/** @brief Returns the keys of the StaticHashmap, in the order they were given. */
+		[[nodiscard]] constexpr const std::array<Tk, N>& Keys() const noexcept { return m_Keys; }
+		
+		/** @brief Returns the values of the StaticHashmap, in the order they were given. */
+		[[nodiscard]] constexpr const std::array<Tv, N>& Values() const noexcept { return m_Values; }
+	};
+	
+	/**
+	 * @brief Constructs a StaticHashmap from a list of entries, deducing the number of entries.
+	 *
+	 * @tparam Tk Key type of the StaticHashmap.
+	 * @tparam Tv Value type of the StaticHashmap.
+	 * @tparam THash Hash function usable in constant expressions. See StaticHash.
+	 * @tparam N Number of entries.
+	 * @param[in] _entries Entries of the StaticHashmap.
+	 * @return The StaticHashmap.
+	 * @throw std::invalid_argument If a key occurs more than once. When evaluated at compile time, this is a compilation error.
+	 */
+	template<typename Tk, typename Tv, typename THash = StaticHash<Tk>, size_t N>
+	constexpr StaticHashmap<Tk, Tv, N, THash> MakeStaticHashmap(const std::pair<Tk, Tv> (&_entries)[N]) {
+		return StaticHashmap<Tk, Tv, N, THash>(_entries);
+	}
+	
+} // LouiEriksson
+
+#endif //LOUIERIKSSON_STATICHASHMAP_HPP
@@ -108,7 +108,13 @@ int main([[maybe_unused]] int _argc, [[maybe_unused]] char* _argv[]) {
 				while (last_size < iterations) {
 					if (hashmap.size() > last_size) {
 						for (int i = last_size; i < hashmap.size(); ++i) {
-							assert((hashmap.Get(i).value() == std::to_string(i)));
+							
+							// Hold the entry's stripe while comparing it, as the writer may relocate the entry once the stripe is released.
+							decltype(hashmap)::ConstAccessor accessor;
+							
+							[[maybe_unused]] const auto found = hashmap.Find(i, accessor);
+							
+							assert((found && *accessor == std::to_string(i)));
 						}
 						last_size = hashmap.size();
 					}
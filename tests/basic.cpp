@@ -1,13 +1,46 @@
+#include "../ConcurrentHashmap.hpp"
+#include "../DistributedSharedMutex.hpp"
+#include "../EpochHashmap.hpp"
+#include "../FixedHashmap.hpp"
+#include "../FrozenHashmap.hpp"
 #include "../Hashmap.hpp"
+#include "../OrderedHashmap.hpp"
+#include "../ShardedHashmap.hpp"
+#include "../SoAHashmap.hpp"
+#include "../SmallHashmap.hpp"
+#include "../StaticHashmap.hpp"
 
+#include <array>
 #include <iostream>
 #include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 /**
  * @file basic.cpp
  * @brief Basic tests for the functionality of the hashmap.
  */
+
+struct Striped : LouiEriksson::HashmapPolicy {
+	static constexpr size_t Stripes = 4U;
+};
+
+struct Distributed : LouiEriksson::HashmapPolicy {
+	using Mutex = LouiEriksson::DistributedSharedMutex<>;
+};
+
+struct Combined : LouiEriksson::HashmapPolicy {
+	static constexpr bool Combining = true;
+};
+
+struct Pinned : LouiEriksson::HashmapPolicy {
+	static constexpr bool Stable = true;
+};
+
 int main([[maybe_unused]] int _argc, [[maybe_unused]] char* _argv[]) {
 	
 	LouiEriksson::Hashmap<int, std::string> hashmap;
@@ -86,6 +119,920 @@ int main([[maybe_unused]] int _argc, [[maybe_unused]] char* _argv[]) {
 		std::cout << "Done.\n";
 	}
 	
+	// Test 7: Read-modify-write
+	{
+		std::cout << "Test 7: Read-modify-write..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, int> counters;
+		
+		[[maybe_unused]] const auto added     = counters.GetOrAdd(1, [](const int& _key) { return _key * 10; }).value();
+		[[maybe_unused]] const auto retrieved = counters.GetOrAdd(1, [](const int&     ) { return -1;          }).value();
+		
+		assert((added     == 10) && "Failed on GetOrAdd insertion.");
+		assert((retrieved == 10) && "Failed on GetOrAdd retrieval.");
+		
+		for (int i = 0; i < 5; ++i) {
+			counters.AddOrUpdate(2, 1, [](int& _value) { ++_value; });
+		}
+		assert((counters.Get(2).value() == 5) && "Failed on AddOrUpdate.");
+		
+		[[maybe_unused]] const auto inserted = counters.Compute(3, [](int& _value, bool _exists) { _value = 7; return !_exists; }).value();
+		assert((inserted == 7) && "Failed on Compute insertion.");
+		
+		[[maybe_unused]] const auto updated = counters.Compute(3, [](int& _value, bool        ) { _value *= 2; return true;   }).value();
+		assert((updated == 14) && "Failed on Compute update.");
+		
+		[[maybe_unused]] const auto kept = counters.Compute(3, [](int&, bool) { return false; }).has_value();
+		assert(!kept && "Failed on Compute removal.");
+		assert(!counters.ContainsKey(3) && counters.size() == 2 && "Failed on Compute removal.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 8: Accessors
+	{
+		std::cout << "Test 8: Accessors..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string> map;
+		
+		{
+			decltype(map)::Accessor accessor;
+			
+			[[maybe_unused]] const auto inserted = map.Insert(1, "One", accessor);
+			
+			assert(inserted && "Failed on insertion.");
+			assert((accessor.key() == 1 && *accessor == "One") && "Failed on insertion.");
+			
+			accessor->append("!");
+		}
+		{
+			decltype(map)::Accessor accessor;
+			
+			[[maybe_unused]] const auto inserted = map.Insert(1, "Ignored", accessor);
+			
+			assert(!inserted && "Failed on duplicate insertion.");
+			assert((accessor.value() == "One!") && "Failed on in-place modification.");
+		}
+		{
+			decltype(map)::ConstAccessor accessor;
+			
+			[[maybe_unused]] const auto found = map.Find(1, accessor);
+			
+			assert(found && (*accessor == "One!") && "Failed on key 1.");
+			
+			[[maybe_unused]] const auto missing = !map.Find(2, accessor);
+			
+			assert(missing && accessor.empty() && "Failed on key 2.");
+		}
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 9: Lock striping
+	{
+		std::cout << "Test 9: Lock striping..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string, Striped> map;
+		
+		for (int i = 0; i < 100; ++i) {
+			[[maybe_unused]] const auto added = map.Add(i, std::to_string(i));
+			
+			assert(added && "Failed on insertion.");
+		}
+		for (int i = 0; i < 100; i += 2) {
+			[[maybe_unused]] const auto removed = map.Remove(i);
+			
+			assert(removed && "Failed on deletion.");
+		}
+		
+		map.Trim();
+		
+		auto copy  = map;
+		auto moved = std::move(map);
+		
+		assert(map.empty() && "Failed on move.");
+		
+		for (int i = 0; i < 100; ++i) {
+			assert((copy.ContainsKey(i) == (i % 2 == 1) && moved.ContainsKey(i) == (i % 2 == 1)) && "Failed on copy.");
+		}
+		assert((copy.size() == 50 && moved.size() == 50) && "Failed on copy.");
+		
+		// Keys sharing a factor with the number of stripes must still be spread across every stripe.
+		LouiEriksson::Hashmap<int, int, Striped> strided;
+		
+		for (int i = 0; i < 1000; ++i) {
+			[[maybe_unused]] const auto added = strided.Add(i * static_cast<int>(Striped::Stripes), i);
+			
+			assert(added && "Failed on insertion.");
+		}
+		for (int i = 0; i < 1000; ++i) {
+			assert((strided.Get(i * static_cast<int>(Striped::Stripes)).value() == i) && "Failed on retrieval.");
+		}
+		assert(strided.size() == 1000U && "Failed on insertion.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 10: Sharding
+	{
+		std::cout << "Test 10: Sharding..." << std::flush;
+		
+		LouiEriksson::ShardedHashmap<int, std::string, 8U> map;
+		
+		for (int i = 0; i < 100; ++i) {
+			[[maybe_unused]] const auto added = map.Add(i, std::to_string(i));
+			
+			assert(added && "Failed on insertion.");
+		}
+		for (int i = 0; i < 100; i += 2) {
+			[[maybe_unused]] const auto removed = map.Remove(i);
+			
+			assert(removed && "Failed on deletion.");
+		}
+		
+		map.Assign(1, "One");
+		
+		assert((map.Get(1).value() == "One") && "Failed on key 1.");
+		assert(&map.Shard(1) == &map.Shard(1) && map.Shard(1).ContainsKey(1) && "Failed on shard selection.");
+		
+		size_t count = 0U;
+		for ([[maybe_unused]] const auto& kvp : map) {
+			assert((kvp.first % 2 == 1) && "Failed on iteration.");
+			++count;
+		}
+		assert((count == 50 && map.size() == 50 && map.Keys().size() == 50) && "Failed on size.");
+		
+		map.Clear();
+		
+		assert(map.empty() && map.begin() == map.end() && "Failed on clearing.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 11: Epoch-protected reads
+	{
+		std::cout << "Test 11: Epoch-protected reads..." << std::flush;
+		
+		LouiEriksson::EpochHashmap<int, std::string> map { { 1, "One" }, { 2, "Two" } };
+		
+		for (int i = 3; i < 100; ++i) {
+			[[maybe_unused]] const auto added = map.Add(i, std::to_string(i));
+			
+			assert(added && "Failed on insertion.");
+		}
+		[[maybe_unused]] const auto duplicate = map.Add(1, "Ignored");
+		
+		assert(!duplicate && "Failed on duplicate insertion.");
+		
+		map.Assign(1, "New One");
+		
+		assert((map.Get(1).value() == "New One") && "Failed on key 1.");
+		[[maybe_unused]] const auto read = map.Read(2, []([[maybe_unused]] const std::string& _value) { assert(_value == "Two"); });
+		
+		assert(read && "Failed on key 2.");
+		
+		[[maybe_unused]] const auto removed = map.Remove(2);
+		
+		assert(removed && !map.ContainsKey(2) && !map.Get(2) && "Failed on deletion.");
+		assert((map.size() == 98 && map.Keys().size() == 98) && "Failed on size.");
+		
+		map.Clear();
+		
+		assert(map.empty() && !map.ContainsKey(1) && "Failed on clearing.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 12: Optimistic reads
+	{
+		std::cout << "Test 12: Optimistic reads..." << std::flush;
+		
+		LouiEriksson::EpochHashmap<int, int> map;
+		
+		[[maybe_unused]] int value = -1;
+		
+		[[maybe_unused]] auto copied = map.TryGetCopy(1, value);
+		assert(!copied && value == -1 && "Failed on missing key.");
+		
+		map.Add(1, 10);
+		
+		copied = map.TryGetCopy(1, value);
+		assert(copied && value == 10 && "Failed on key 1.");
+		
+		map.Assign(1, 20);
+		
+		copied = map.TryGetCopy(1, value);
+		assert(copied && value == 20 && "Failed on in-place assignment.");
+		
+		for (int i = 2; i < 100; ++i) {
+			map.Add(i, i);
+		}
+		
+		copied = map.TryGetCopy(1, value);
+		assert(copied && value == 20 && "Failed on resize.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 13: Lock-free operations
+	{
+		std::cout << "Test 13: Lock-free operations..." << std::flush;
+		
+		LouiEriksson::ConcurrentHashmap<int, std::string> map { { 1, "One" }, { 2, "Two" } };
+		
+		for (int i = 3; i < 1000; ++i) {
+			[[maybe_unused]] const auto added = map.Add(i, std::to_string(i));
+			
+			assert(added && "Failed on insertion.");
+		}
+		[[maybe_unused]] const auto duplicate = map.Add(1, "Ignored");
+		
+		assert(!duplicate && "Failed on duplicate insertion.");
+		
+		map.Assign(1, "New One");
+		
+		assert((map.Get(1).value() == "New One") && "Failed on key 1.");
+		assert((map.Get(999).value() == "999") && "Failed on key 999.");
+		
+		for (int i = 0; i < 1000; i += 2) {
+			map.Remove(i);
+		}
+		for (int i = 0; i < 1000; ++i) {
+			assert((map.ContainsKey(i) == (i % 2 == 1)) && "Failed on deletion.");
+		}
+		assert((map.size() == 500 && map.Keys().size() == 500) && "Failed on size.");
+		
+		map.Clear();
+		
+		assert(map.empty() && !map.ContainsKey(1) && "Failed on clearing.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 14: Incremental resizing
+	{
+		std::cout << "Test 14: Incremental resizing..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, int, Striped> map;
+		
+		for (int i = 0; i < 10000; ++i) {
+			[[maybe_unused]] const auto added = map.Add(i, i * 2);
+			
+			assert(added && "Failed on insertion.");
+		}
+		for (int i = 0; i < 10000; ++i) {
+			assert((map.Get(i).value() == i * 2) && "Failed on retrieval.");
+		}
+		assert((map.size() == 10000 && map.Keys().size() == 10000) && "Failed on size.");
+		
+		auto copy = map;
+		
+		assert((copy.size() == 10000 && copy.Get(9999).value() == 19998) && "Failed on copy.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 15: Distributed reader lock
+	{
+		std::cout << "Test 15: Distributed reader lock..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string, Distributed> map;
+		
+		for (int i = 0; i < 100; ++i) {
+			[[maybe_unused]] const auto added = map.Add(i, std::to_string(i));
+			
+			assert(added && "Failed on insertion.");
+		}
+		
+		map.Assign(1, "One");
+		
+		{
+			decltype(map)::ConstAccessor accessor;
+			
+			[[maybe_unused]] const auto found = map.Find(1, accessor);
+			
+			assert(found && (*accessor == "One") && "Failed on key 1.");
+		}
+		
+		[[maybe_unused]] const auto removed = map.Remove(2);
+		
+		assert(removed && !map.ContainsKey(2) && "Failed on deletion.");
+		assert((map.size() == 99 && map.Keys().size() == 99) && "Failed on size.");
+		
+		LouiEriksson::DistributedSharedMutex<> mutex;
+		
+		mutex.lock_shared();
+		
+		[[maybe_unused]] const auto exclusive = mutex.try_lock();
+		[[maybe_unused]] const auto shared    = mutex.try_lock_shared();
+		
+		assert(!exclusive && shared && "Failed on shared ownership.");
+		
+		if (shared) {
+			mutex.unlock_shared();
+		}
+		mutex.unlock_shared();
+		
+		[[maybe_unused]] const auto owned   = mutex.try_lock();
+		[[maybe_unused]] const auto blocked = !mutex.try_lock_shared();
+		
+		assert(owned && blocked && "Failed on exclusive ownership.");
+		
+		if (owned) {
+			mutex.unlock();
+		}
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 16: Combined writes
+	{
+		std::cout << "Test 16: Combined writes..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string, Combined> map;
+		
+		for (int i = 0; i < 100; ++i) {
+			[[maybe_unused]] const auto added = map.Add(i, std::to_string(i));
+			
+			assert(added && "Failed on insertion.");
+		}
+		[[maybe_unused]] const auto duplicate = map.Add(1, "Ignored");
+		
+		assert(!duplicate && "Failed on duplicate insertion.");
+		
+		map.Assign(1, "One");
+		map.Assign(100, std::string("100"));
+		
+		assert((map.Get(1).value() == "One" && map.Get(100).value() == "100") && "Failed on assignment.");
+		
+		[[maybe_unused]] const auto removed = map.Remove(2);
+		
+		assert(removed && !map.ContainsKey(2) && "Failed on deletion.");
+		
+		[[maybe_unused]] const auto repeated = map.Remove(2);
+		
+		assert(!repeated && "Failed on repeated deletion.");
+		assert((map.size() == 100 && map.Keys().size() == 100) && "Failed on size.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 17: Transactions
+	{
+		std::cout << "Test 17: Transactions..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string, Striped> map;
+		
+		{
+			auto transaction = map.Transaction();
+			
+			for (int i = 0; i < 100; ++i) {
+				[[maybe_unused]] const auto added = transaction.Add(i, std::to_string(i));
+				
+				assert(added && "Failed on insertion.");
+			}
+			
+			[[maybe_unused]] const auto duplicate = transaction.Add(1, "Ignored");
+			
+			assert(!duplicate && "Failed on duplicate insertion.");
+			
+			// Move a value between keys, while growing the Hashmap.
+			if (const auto value = transaction.Get(1)) {
+				transaction.Assign(1000, *value);
+				transaction.Remove(1);
+			}
+			
+			assert((!transaction.ContainsKey(1) && transaction.Get(1000).value() == "1") && "Failed on move.");
+			assert(transaction.size() == 100 && "Failed on size.");
+		}
+		{
+			const auto transaction = map.ReadTransaction();
+			
+			assert((transaction.Get(1000).value() == "1" && transaction.ContainsKey(99)) && "Failed on retrieval.");
+			assert(!transaction.ContainsKey(1) && transaction.size() == 100 && "Failed on retrieval.");
+		}
+		
+		[[maybe_unused]] const auto added = map.Add(1, "One");
+		
+		assert(added && "Failed on release.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 18: Extraction and merging
+	{
+		std::cout << "Test 18: Extraction and merging..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string, Striped> staging;
+		LouiEriksson::Hashmap<int, std::string, Striped> live { { 0, "Zero" } };
+		
+		for (int i = 0; i < 100; ++i) {
+			staging.Add(i, std::to_string(i));
+		}
+		
+		auto node = staging.Extract(1);
+		
+		assert((node && node.key() == 1 && node.value() == "1") && "Failed on extraction.");
+		assert((!staging.ContainsKey(1) && staging.size() == 99) && "Failed on extraction.");
+		[[maybe_unused]] const auto missing = staging.Extract(1).empty();
+		
+		assert(missing && "Failed on missing key.");
+		
+		[[maybe_unused]] const auto inserted = live.Insert(std::move(node));
+		
+		assert(inserted && node.empty() && "Failed on insertion.");
+		assert((live.Get(1).value() == "1") && "Failed on insertion.");
+		
+		live.Merge(staging);
+		
+		assert((live.size() == 100 && live.Get(99).value() == "99" && live.Get(0).value() == "Zero") && "Failed on merge.");
+		assert((staging.size() == 1 && staging.Get(0).value() == "0") && "Failed on merge conflict.");
+		
+		auto duplicate = staging.Extract(0);
+		
+		[[maybe_unused]] const auto conflicted = !live.Insert(std::move(duplicate));
+		
+		assert(conflicted && duplicate.value() == "0" && "Failed on duplicate insertion.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 19: Bulk merging
+	{
+		std::cout << "Test 19: Bulk merging..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, int, Striped> counts { { 0, 100 } };
+		
+		std::vector<LouiEriksson::Hashmap<int, int, Striped>> partials(4U);
+		
+		for (size_t i = 0U; i < partials.size(); ++i) {
+			for (int j = 0; j < 1000; ++j) {
+				partials[i].Add(j, 1);
+			}
+		}
+		
+		counts.MergeFrom(std::move(partials), [](int& _existing, int&& _incoming) { _existing += _incoming; });
+		
+		assert((counts.size() == 1000 && counts.Get(0).value() == 104 && counts.Get(999).value() == 4) && "Failed on merge.");
+		assert((partials[0].empty() && partials[3].empty()) && "Failed on consumption.");
+		
+		std::vector<LouiEriksson::Hashmap<int, int, Striped>> replacements(2U);
+		
+		replacements[0].Add(0, 1);
+		replacements[1].Add(0, 2);
+		replacements[1].Add(1000, 3);
+		
+		counts.MergeFrom(std::move(replacements), LouiEriksson::MergeConflict::Replace);
+		
+		assert((counts.size() == 1001 && counts.Get(0).value() == 2 && counts.Get(1000).value() == 3) && "Failed on replacement.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 20: Snapshots
+	{
+		std::cout << "Test 20: Snapshots..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, int, Striped> map;
+		
+		for (int i = 0; i < 100; ++i) {
+			map.Add(i, i);
+		}
+		
+		const auto first = map.Snapshot();
+		
+		map.Assign(0, -1);
+		map.Remove(1);
+		map.Add(100, 100);
+		
+		assert((first.size() == 100 && first.Get(0).value() == 0 && first.ContainsKey(1) && !first.ContainsKey(100)) && "Failed on isolation.");
+		assert((map.size() == 100 && map.Get(0).value() == -1 && !map.ContainsKey(1) && map.ContainsKey(100)) && "Failed on modification.");
+		
+		int sum = 0;
+		
+		for (const auto& kvp : first) {
+			sum += kvp.second;
+		}
+		
+		assert(sum == 4950 && "Failed on snapshot iteration.");
+		
+		const auto second = map.Snapshot();
+		
+		assert((second.version() == first.version() + 1U && second.Get(0).value() == -1) && "Failed on versioning.");
+		
+		for (int i = 101; i < 1000; ++i) {
+			map.Add(i, i);
+		}
+		
+		sum = 0;
+		
+		for (const auto& kvp : map) {
+			sum += kvp.second;
+		}
+		
+		assert((second.size() == 100 && map.size() == 999 && sum == 499498) && "Failed on resize.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 21: Binary serialisation
+	{
+		std::cout << "Test 21: Binary serialisation..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, double, Striped> numbers;
+		
+		for (int i = 0; i < 10000; ++i) {
+			numbers.Add(i, i * 0.5);
+		}
+		
+		std::stringstream raw;
+		
+		[[maybe_unused]] const auto saved = numbers.SaveBinary(raw);
+		
+		assert(saved && "Failed on raw save.");
+		
+		LouiEriksson::Hashmap<int, double, Striped> restored { { -1, -1.0 } };
+		
+		[[maybe_unused]] const auto loaded = restored.LoadBinary(raw);
+		
+		assert(loaded && "Failed on raw load.");
+		assert((restored.size() == 10000 && !restored.ContainsKey(-1) && restored.Get(9999).value() == 4999.5) && "Failed on raw round trip.");
+		
+		LouiEriksson::Hashmap<std::string, std::string> names;
+		names.Add("One", "Un");
+		names.Add("Two", "Deux");
+		names.Add("", "Rien");
+		
+		std::stringstream encoded;
+		
+		[[maybe_unused]] const auto encodedSaved = names.SaveBinary(encoded);
+		
+		assert(encodedSaved && "Failed on encoded save.");
+		
+		LouiEriksson::Hashmap<std::string, std::string> copy;
+		
+		[[maybe_unused]] const auto encodedLoaded = copy.LoadBinary(encoded);
+		
+		assert((encodedLoaded && copy.size() == 3U && copy.Get("Two").value() == "Deux" && copy.Get("").value() == "Rien") && "Failed on encoded round trip.");
+		
+		// A corrupt count must fail once the stream runs out, rather than allocating a table for every entry it claims.
+		auto inflated = raw.str();
+		
+		const uint64_t claimed = UINT64_C(1) << 40U;
+		std::memcpy(&inflated[sizeof(uint32_t) * 4U], &claimed, sizeof(claimed));
+		
+		std::stringstream corrupt(inflated);
+		
+		[[maybe_unused]] const auto corruptLoaded = restored.LoadBinary(corrupt);
+		
+		assert((!corruptLoaded && restored.size() == 10000) && "Failed on corrupt count.");
+		
+		std::stringstream truncated(raw.str().substr(0U, 64U));
+		
+		std::exception_ptr exception;
+		
+		[[maybe_unused]] const auto truncatedLoaded = restored.LoadBinary(truncated, exception);
+		
+		assert((!truncatedLoaded && exception != nullptr && restored.size() == 10000) && "Failed on truncated load.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 22: Frozen maps
+	{
+		std::cout << "Test 22: Frozen maps..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string> names;
+		
+		for (int i = 0; i < 1000; ++i) {
+			names.Add(i, std::to_string(i));
+		}
+		
+		[[maybe_unused]] const auto frozenToFile = names.Freeze("basic_test_frozen.bin");
+		
+		assert(frozenToFile && "Failed on freezing.");
+		
+		{
+			const auto frozen = LouiEriksson::FrozenHashmap<int, std::string>::Open("basic_test_frozen.bin");
+			
+			assert((frozen.size() == 1000 && frozen.Get(999).value() == "999" && frozen.Get(0).value() == "0" && !frozen.ContainsKey(1000)) && "Failed on mapped lookup.");
+		}
+		
+		std::remove("basic_test_frozen.bin");
+		
+		LouiEriksson::Hashmap<int, double> numbers { { 1, 0.5 }, { 2, 1.5 } };
+		
+		std::stringstream stream;
+		
+		[[maybe_unused]] const auto frozenToStream = numbers.Freeze(stream);
+		
+		assert(frozenToStream && "Failed on freezing to a stream.");
+		
+		const auto bytes = stream.str();
+		
+		std::vector<uint64_t> memory((bytes.size() + 7U) / 8U);
+		std::memcpy(memory.data(), bytes.data(), bytes.size());
+		
+		const LouiEriksson::FrozenHashmap<int, double> frozen(memory.data(), bytes.size());
+		
+		assert((frozen.size() == 2 && frozen.Get(2).value() == 1.5 && !frozen.Get(3)) && "Failed on in-memory lookup.");
+		
+		// Simulate a file written with a different hash function.
+		LouiEriksson::FrozenLayout::Header header {};
+		std::memcpy(&header, memory.data(), sizeof(header));
+		
+		header.m_Probe ^= 1U;
+		std::memcpy(memory.data(), &header, sizeof(header));
+		
+		[[maybe_unused]] auto rejected = false;
+		
+		try {
+			const LouiEriksson::FrozenHashmap<int, double> mismatched(memory.data(), bytes.size());
+		}
+		catch (const std::runtime_error&) {
+			rejected = true;
+		}
+		
+		assert(rejected && "Failed on hash function mismatch.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 23: Perfect hashing
+	{
+		std::cout << "Test 23: Perfect hashing..." << std::flush;
+		
+		LouiEriksson::Hashmap<std::string, int> opcodes;
+		
+		for (int i = 0; i < 5000; ++i) {
+			opcodes.Add("op" + std::to_string(i), i);
+		}
+		
+		const auto perfect = opcodes.ToPerfectHashmap();
+		
+		auto matched = perfect.size() == 5000;
+		
+		for (int i = 0; i < 5000; ++i) {
+			matched &= perfect.Get("op" + std::to_string(i)).value() == i;
+		}
+		
+		assert((matched && !perfect.ContainsKey("op5000") && !perfect.Get("")) && "Failed on perfect lookup.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 24: Compile-time maps
+	{
+		std::cout << "Test 24: Compile-time maps..." << std::flush;
+		
+		static constexpr auto keywords = LouiEriksson::MakeStaticHashmap<std::string_view, int>({
+			{ "if",    0 },
+			{ "else",  1 },
+			{ "while", 2 },
+			{ "for",   3 }
+		});
+		
+		static_assert(keywords.size() == 4U && keywords.Get("while").value() == 2 && !keywords.ContainsKey("elif"), "Failed on compile-time lookup.");
+		
+		const std::string identifier = "for";
+		
+		assert((keywords.Get(identifier).value() == 3 && !keywords.Get(identifier + "each")) && "Failed on run-time lookup.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 25: Fixed capacity
+	{
+		std::cout << "Test 25: Fixed capacity..." << std::flush;
+		
+		LouiEriksson::FixedHashmap<int, int, 8> fixed;
+		
+		for (int i = 0; i < 8; ++i) {
+			fixed.Add(i * 8, i);
+		}
+		
+		[[maybe_unused]] const auto overflowAdded    = fixed.Add(64, 8);
+		[[maybe_unused]] const auto overflowAssigned = fixed.Assign(64, 8);
+		[[maybe_unused]] const auto assigned         = fixed.Assign(0, -1);
+		
+		assert((fixed.size() == 8U && !overflowAdded && !overflowAssigned && assigned) && "Failed on filling.");
+		
+		// Every key shares a home slot, so removal must shift the following entries back.
+		[[maybe_unused]] const auto removed = fixed.Remove(8);
+		
+		assert((removed && !fixed.ContainsKey(8) && fixed.Get(56).value() == 7 && fixed.Get(0).value() == -1) && "Failed on removal.");
+		
+		[[maybe_unused]] const auto reused = fixed.Add(64, 8);
+		
+		assert((reused && fixed.size() == 8U) && "Failed on reuse.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 26: Small maps
+	{
+		std::cout << "Test 26: Small maps..." << std::flush;
+		
+		LouiEriksson::SmallHashmap<int, std::string, 4> small;
+		
+		for (int i = 0; i < 4; ++i) {
+			small.Add(i, std::to_string(i));
+		}
+		
+		small.Remove(0);
+		small.Assign(4, "4");
+		
+		assert((small.IsInline() && small.size() == 4U && small.Get(3).value() == "3" && !small.ContainsKey(0)) && "Failed on inline storage.");
+		
+		small.Add(5, "5");
+		
+		assert((!small.IsInline() && small.size() == 5U && small.Get(1).value() == "1" && small.Get(5).value() == "5") && "Failed on upgrade.");
+		
+		small.Clear();
+		
+		assert((small.IsInline() && small.empty()) && "Failed on clearing.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 27: Insertion order
+	{
+		std::cout << "Test 27: Insertion order..." << std::flush;
+		
+		LouiEriksson::OrderedHashmap<std::string, int> ordered {
+			{ "c", 3 },
+			{ "a", 1 },
+			{ "b", 2 }
+		};
+		
+		ordered.Remove("a");
+		ordered.Add("d", 4);
+		ordered.Assign("c", 30);
+		
+		std::string order;
+		
+		for (const auto& kvp : ordered) {
+			order += kvp.first;
+		}
+		
+		assert((order == "cbd" && ordered.Values() == std::vector<int>({ 30, 2, 4 }) && ordered.Get("c").value() == 30 && !ordered.ContainsKey("a")) && "Failed on ordering.");
+		
+		for (int i = 0; i < 1000; ++i) {
+			ordered.Add(std::to_string(i), i);
+			ordered.Remove(std::to_string(i - 1));
+		}
+		
+		assert((ordered.size() == 4U && ordered.Keys().back() == "999") && "Failed on compaction.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 28: Structure of arrays
+	{
+		std::cout << "Test 28: Structure of arrays..." << std::flush;
+		
+		LouiEriksson::SoAHashmap<int, std::string> soa;
+		
+		for (int i = 0; i < 1000; ++i) {
+			[[maybe_unused]] const auto added = soa.Add(i, std::to_string(i));
+			
+			assert(added && "Failed on Add.");
+		}
+		
+		[[maybe_unused]] const auto duplicate = soa.Add(0, "x");
+		
+		assert((!duplicate && soa.size() == 1000U) && "Failed on duplicate Add.");
+		
+		for (int i = 0; i < 1000; i += 2) {
+			[[maybe_unused]] const auto removed = soa.Remove(i);
+			
+			assert(removed && "Failed on Remove.");
+		}
+		
+		soa.Assign(1, "one");
+		
+		for (int i = 0; i < 1000; ++i) {
+			assert((soa.ContainsKey(i) == (i % 2 == 1)) && "Failed on ContainsKey.");
+		}
+		
+		{
+			LouiEriksson::SoAHashmap<int, std::string>::ConstAccessor accessor;
+			
+			[[maybe_unused]] const auto found = soa.Find(1, accessor);
+			
+			assert((found && accessor.key() == 1 && *accessor == "one") && "Failed on Find.");
+			
+			[[maybe_unused]] const auto absent = !soa.Find(2, accessor);
+			
+			assert((absent && accessor.empty()) && "Failed on Find (absent).");
+		}
+		
+		assert((soa.size() == 500U && soa.Get(999).value() == "999" && !soa.Get(998).has_value()) && "Failed on Get.");
+		
+		soa.Clear();
+		
+		assert(soa.empty() && "Failed on Clear.");
+		
+		[[maybe_unused]] const auto reused = soa.Add(7, "7");
+		
+		assert(reused && "Failed on Clear.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 29: Out-of-line values
+	{
+		std::cout << "Test 29: Out-of-line values..." << std::flush;
+		
+		struct Record final {
+			
+			std::array<int, 64U> m_Data {};
+		};
+		
+		static_assert(sizeof(Record) > LouiEriksson::HashmapPolicy::OutOfLine, "Record must be stored out of line.");
+		
+		LouiEriksson::Hashmap<int, Record> records(1);
+		
+		Record first;
+		first.m_Data[0U] = 42;
+		
+		records.Add(0, first);
+		
+		[[maybe_unused]] const auto* address = &records.Get(0).value();
+		
+		// Growing the Hashmap moves pointers to the entries, rather than the entries themselves.
+		for (int i = 1; i < 10000; ++i) {
+			
+			Record record;
+			record.m_Data[0U] = i;
+			
+			records.Add(i, record);
+		}
+		
+		assert((&records.Get(0).value() == address && address->m_Data[0U] == 42) && "Failed on resize.");
+		
+		// Extracting an entry and inserting it elsewhere hands over its allocation, rather than moving the entry.
+		const auto* node = &records.Get(1).value();
+		
+		LouiEriksson::Hashmap<int, Record> other;
+		
+		[[maybe_unused]] const auto relinked = other.Insert(records.Extract(1)) && &other.Get(1).value() == node;
+		[[maybe_unused]] const auto returned = records.Insert(other.Extract(1)) && &records.Get(1).value() == node;
+		
+		assert((relinked && returned && other.empty()) && "Failed on extraction.");
+		
+		records.Remove(0);
+		
+		size_t sum = 0U;
+		
+		for (const auto& kvp : records) {
+			sum += static_cast<size_t>(kvp.second.m_Data[0U]);
+		}
+		
+		const auto copy = records;
+		
+		assert((sum == 49995000U && copy.size() == 9999U && copy.Get(9999)->m_Data[0U] == 9999) && "Failed on copy.");
+		
+		std::cout << "Done.\n";
+	}
+	
+	// Test 30: Pointer stability
+	{
+		std::cout << "Test 30: Pointer stability..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, int, Pinned> map(1);
+		
+		map.Add(0, 0);
+		
+		[[maybe_unused]] const int* address = &map.Get(0).value();
+		
+		const auto snapshot = map.Snapshot();
+		
+		for (int i = 1; i < 10000; ++i) {
+			map.Add(i, i);
+		}
+		
+		map.Assign(0, 42);
+		
+		LouiEriksson::Hashmap<int, int, Pinned> other;
+		
+		for (int i = 10000; i < 20000; ++i) {
+			other.Add(i, i);
+		}
+		
+		map.Merge(other);
+		
+		for (int i = 1; i < 20000; i += 2) {
+			map.Remove(i);
+		}
+		
+		map.Trim();
+		
+		assert((&map.Get(0).value() == address && *address == 42 && snapshot.Get(0).value() == 0) && "Failed on stability.");
+		
+		std::cout << "Done.\n";
+	}
+	
 	std::cout << "All tests passed!\n";
 	
 	return 0;
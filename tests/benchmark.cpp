@@ -0,0 +1,251 @@
+#include "../DistributedSharedMutex.hpp"
+#include "../EpochHashmap.hpp"
+#include "../Hashmap.hpp"
+#include "../OrderedHashmap.hpp"
+#include "../SoAHashmap.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @file benchmark.cpp
+ * @brief Throughput benchmarks for the hashmaps.
+ */
+
+static constexpr int entries = 100000;
+
+static constexpr auto duration = std::chrono::milliseconds(250);
+
+struct Distributed : LouiEriksson::HashmapPolicy {
+	using Mutex = LouiEriksson::DistributedSharedMutex<>;
+};
+
+/** @brief A large value, representative of a record stored by value. */
+struct Large final {
+	
+	std::array<uint64_t, 32U> m_Data {};
+};
+
+/**
+ * @brief Measures the throughput of concurrent reads of a hashmap.
+ * @param[in] _hashmap The hashmap to read.
+ * @param[in] _readers The number of reading threads.
+ * @return The total number of reads per second.
+ */
+template<typename T>
+double ReadThroughput(const T& _hashmap, const size_t& _readers) {
+	
+	std::atomic<bool> start { false };
+	std::atomic<bool> stop  { false };
+	
+	std::vector<size_t> counts(_readers, 0U);
+	
+	std::vector<std::thread> threads;
+	threads.reserve(_readers);
+	
+	for (size_t i = 0U; i < _readers; ++i) {
+		
+		threads.emplace_back([i, &start, &stop, &counts, &_hashmap]() {
+			
+			while (!start.load(std::memory_order_acquire)) {
+				std::this_thread::yield();
+			}
+			
+			size_t count = 0U;
+			
+			for (int j = static_cast<int>(i); !stop.load(std::memory_order_relaxed); j = (j + 7) % entries) {
+				
+				if (_hashmap.Get(j)) {
+					++count;
+				}
+			}
+			
+			counts[i] = count;
+		});
+	}
+	
+	const auto begin = std::chrono::steady_clock::now();
+	
+	start.store(true, std::memory_order_release);
+	std::this_thread::sleep_for(duration);
+	stop.store(true, std::memory_order_relaxed);
+	
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	
+	const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	
+	size_t total = 0U;
+	for (const auto& count : counts) {
+		total += count;
+	}
+	
+	return static_cast<double>(total) / elapsed;
+}
+
+/**
+ * @brief Prints the read throughput of a hashmap for an increasing number of readers.
+ * @param[in] _name Name of the hashmap.
+ * @param[in] _hashmap The hashmap to read.
+ */
+template<typename T>
+void Report(const std::string& _name, const T& _hashmap) {
+	
+	const auto cores = std::max(std::thread::hardware_concurrency(), 1U);
+	
+	std::cout << _name << ":\n";
+	
+	double baseline = 0.0;
+	
+	for (size_t readers = 1U; readers <= cores; readers *= 2U) {
+		
+		const auto throughput = ReadThroughput(_hashmap, readers);
+		
+		if (readers == 1U) {
+			baseline = throughput;
+		}
+		
+		std::cout << "\t" << readers << " reader(s): " << static_cast<size_t>(throughput) << " reads/s (" << (throughput / baseline) << "x)\n";
+	}
+}
+
+/**
+ * @brief Measures the throughput of iterating a hashmap on a single thread.
+ * @param[in] _hashmap The hashmap to iterate.
+ * @return The number of entries visited per second.
+ */
+template<typename T>
+double IterationThroughput(const T& _hashmap) {
+	
+	size_t visited = 0U;
+	size_t sum     = 0U;
+	
+	const auto begin = std::chrono::steady_clock::now();
+	
+	do {
+		for (const auto& kvp : _hashmap) {
+			sum += static_cast<size_t>(kvp.second);
+			
+			++visited;
+		}
+	}
+	while (std::chrono::steady_clock::now() - begin < duration);
+	
+	const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	
+	// Prevent the loop from being optimised away.
+	if (sum == 0U) {
+		std::cout << "";
+	}
+	
+	return static_cast<double>(visited) / elapsed;
+}
+
+/**
+ * @brief Measures the throughput of finding entries of a hashmap on a single thread, reading part of each value in place.
+ * @param[in] _hashmap The hashmap to search.
+ * @return The number of lookups per second.
+ */
+template<typename T>
+double FindThroughput(const T& _hashmap) {
+	
+	size_t found = 0U;
+	size_t sum   = 0U;
+	
+	typename T::ConstAccessor accessor;
+	
+	const auto begin = std::chrono::steady_clock::now();
+	
+	do {
+		for (int i = 0; i < entries; ++i) {
+			
+			// Look keys up in a scattered order, so that successive lookups do not share cache lines.
+			if (_hashmap.Find(static_cast<int>((static_cast<size_t>(i) * 7919U) % entries), accessor)) {
+				sum += accessor->m_Data[0U];
+				
+				++found;
+			}
+		}
+	}
+	while (std::chrono::steady_clock::now() - begin < duration);
+	
+	accessor.release();
+	
+	const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	
+	// Prevent the loop from being optimised away.
+	if (sum == 0U) {
+		std::cout << "";
+	}
+	
+	return static_cast<double>(found) / elapsed;
+}
+
+int main([[maybe_unused]] int _argc, [[maybe_unused]] char* _argv[]) {
+	
+	std::cout << "~ BENCHMARKS ~\n";
+	
+	// Benchmark 1: Read scaling
+	{
+		LouiEriksson::Hashmap<int, int>              locking(entries);
+		LouiEriksson::Hashmap<int, int, Distributed> distributed(entries);
+		LouiEriksson::EpochHashmap<int, int>         epoch(entries);
+		
+		for (int i = 0; i < entries; ++i) {
+			    locking.Add(i, i);
+			distributed.Add(i, i);
+			      epoch.Add(i, i);
+		}
+		
+		Report("Hashmap::Get",                         locking);
+		Report("Hashmap<DistributedSharedMutex>::Get", distributed);
+		Report("EpochHashmap::Get",                    epoch);
+	}
+	
+	// Benchmark 2: Iteration
+	{
+		LouiEriksson::Hashmap<int, int>        hashmap(entries);
+		LouiEriksson::OrderedHashmap<int, int> ordered;
+		
+		for (int i = 0; i < entries; ++i) {
+			hashmap.Add(i, i);
+			ordered.Add(i, i);
+		}
+		
+		std::cout << "Iteration:\n";
+		std::cout << "\tHashmap: "        << static_cast<size_t>(IterationThroughput(hashmap)) << " entries/s\n";
+		std::cout << "\tOrderedHashmap: " << static_cast<size_t>(IterationThroughput(ordered)) << " entries/s\n";
+	}
+	
+	// Benchmark 3: Large values
+	{
+		LouiEriksson::Hashmap<int, Large> hashmap(entries);
+		LouiEriksson::SoAHashmap<int, Large> soa;
+		
+		soa.Reserve(entries);
+		
+		for (int i = 0; i < entries; ++i) {
+			
+			Large value;
+			value.m_Data[0U] = static_cast<uint64_t>(i);
+			
+			hashmap.Add(i, value);
+			    soa.Add(i, value);
+		}
+		
+		std::cout << "Find (" << sizeof(Large) << "-byte values):\n";
+		std::cout << "\tHashmap: "    << static_cast<size_t>(FindThroughput(hashmap)) << " lookups/s\n";
+		std::cout << "\tSoAHashmap: " << static_cast<size_t>(FindThroughput(soa))     << " lookups/s\n";
+	}
+	
+	return 0;
+}
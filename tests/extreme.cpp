@@ -1,5 +1,10 @@
+#include "../ConcurrentHashmap.hpp"
+#include "../EpochHashmap.hpp"
 #include "../Hashmap.hpp"
+#include "../ShardedHashmap.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <cassert>
 #include <string>
@@ -9,70 +14,240 @@
  * @file extreme.cpp
  * @brief Extreme tests for the functionality of the hashmap.
  */
-int main([[maybe_unused]] int _argc, [[maybe_unused]] char* _argv[]) {
+
+/**
+ * @brief Asserts that the value of a key, if present, matches the key.
+ * @details The value is read through an accessor so that it cannot be modified or relocated while being compared.
+ *
+ * @param[in] _hashmap The hashmap to read.
+ * @param[in] _key The key to read.
+ */
+template<typename T>
+void Verify(T& _hashmap, const int& _key) {
+	
+	typename T::ConstAccessor item;
+	
+	if (_hashmap.Find(_key, item)) {
+		assert(item.value() == std::to_string(_key) && "Item value mismatch!");
+	}
+}
+
+/**
+ * @brief Asserts that the value of a key, if present, matches the key.
+ * @details EpochHashmap returns copies, which are unaffected by concurrent writers.
+ *
+ * @param[in] _hashmap The hashmap to read.
+ * @param[in] _key The key to read.
+ */
+void Verify(LouiEriksson::EpochHashmap<int, std::string>& _hashmap, const int& _key) {
+	
+	if (auto item = _hashmap.Get(_key)) {
+		assert(item.value() == std::to_string(_key) && "Item value mismatch!");
+	}
+}
+
+/**
+ * @brief Asserts that the value of a key, if present, matches the key.
+ * @details ConcurrentHashmap returns copies, which are unaffected by concurrent writers.
+ *
+ * @param[in] _hashmap The hashmap to read.
+ * @param[in] _key The key to read.
+ */
+void Verify(LouiEriksson::ConcurrentHashmap<int, std::string>& _hashmap, const int& _key) {
+	
+	if (auto item = _hashmap.Get(_key)) {
+		assert(item.value() == std::to_string(_key) && "Item value mismatch!");
+	}
+}
+
+/**
+ * @brief Performs concurrent deletions, insertions, overwrites, and reads on a hashmap.
+ * @param[in] _hashmap The hashmap to grind.
+ * @return The elapsed time in milliseconds.
+ */
+template<typename T>
+long long Grind(T& _hashmap) {
+	
+	static constexpr int iterations = 200000;
+	static constexpr int concurrency = 100;
 	
-	LouiEriksson::Hashmap<int, std::string> hashmap;
+	const auto start = std::chrono::steady_clock::now();
+	
+	std::vector<std::pair<std::thread, std::exception_ptr>> threads;
+	threads.reserve(concurrency);
+	
+	// Perform concurrent deletions, insertions, overwrites, and reads.
+	for (int i = 0; i < concurrency; ++i) {
+		
+		threads.emplace_back(
+			std::thread([i, &threads, &_hashmap]() {
+				
+				try {
+					for (int j = 0; j < iterations; ++j) {
+						
+						_hashmap.Remove(j);
+						_hashmap.Add(j, std::to_string(j));
+						_hashmap.Assign(j, std::to_string(j));
+						
+						Verify(_hashmap, j);
+					}
+				}
+				catch (...) {
+					threads[i].second = std::current_exception();
+				}
+			}),
+			nullptr
+		);
+	}
+	
+	// Throw any exceptions:
+	for (auto& thread : threads) {
+		
+		thread.first.join();
+		
+		if (thread.second) {
+			std::rethrow_exception(thread.second);
+		}
+	}
+	
+	const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+	
+	// Assert the hashmap has the correct size.
+	assert(_hashmap.size() == iterations && "Erroneous insertion detected!");
+	
+	// Clear hashmap and assert it is empty.
+	_hashmap.Clear();
+	assert(_hashmap.empty() && "Clearing failed!");
+	
+	return elapsed;
+}
+
+struct Striped : LouiEriksson::HashmapPolicy {
+	static constexpr size_t Stripes = 16U;
+};
+
+struct Combined : LouiEriksson::HashmapPolicy {
+	static constexpr bool Combining = true;
+};
 
+int main([[maybe_unused]] int _argc, [[maybe_unused]] char* _argv[]) {
+	
 	std::cout << "~ EXTREME TESTS ~\n";
 	
 	// Test 1: The grind.
 	{
 		std::cout << "Test 1: The grind..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string> hashmap;
+		
+		const auto elapsed = Grind(hashmap);
+		
+		std::cout << "Done (" << elapsed << "ms).\n";
+	}
 	
-		static constexpr int iterations = 200000;
-		static constexpr int concurrency = 100;
+	// Test 2: The striped grind.
+	{
+		std::cout << "Test 2: The striped grind..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string, Striped> hashmap;
+		
+		const auto elapsed = Grind(hashmap);
+		
+		std::cout << "Done (" << elapsed << "ms).\n";
+	}
+	
+	// Test 3: The sharded grind.
+	{
+		std::cout << "Test 3: The sharded grind..." << std::flush;
+		
+		LouiEriksson::ShardedHashmap<int, std::string, 16U> hashmap;
+		
+		const auto elapsed = Grind(hashmap);
+		
+		std::cout << "Done (" << elapsed << "ms).\n";
+	}
+	
+	// Test 4: The epoch grind.
+	{
+		std::cout << "Test 4: The epoch grind..." << std::flush;
+		
+		LouiEriksson::EpochHashmap<int, std::string> hashmap;
+		
+		const auto elapsed = Grind(hashmap);
+		
+		std::cout << "Done (" << elapsed << "ms).\n";
+	}
+	
+	// Test 5: The lock-free grind.
+	{
+		std::cout << "Test 5: The lock-free grind..." << std::flush;
+		
+		LouiEriksson::ConcurrentHashmap<int, std::string> hashmap;
 		
-		std::vector<std::pair<std::thread, std::exception_ptr>> threads;
+		const auto elapsed = Grind(hashmap);
+		
+		std::cout << "Done (" << elapsed << "ms).\n";
+	}
+	
+	// Test 6: Torn reads.
+	{
+		std::cout << "Test 6: Torn reads..." << std::flush;
+		
+		struct Triple final {
+			size_t a, b, c;
+		};
+		
+		static constexpr size_t iterations = 1000000;
+		static constexpr int concurrency = 8;
+		
+		LouiEriksson::EpochHashmap<int, Triple> hashmap;
+		hashmap.Add(0, { 0U, 0U, 0U });
+		
+		std::atomic<bool> done { false };
+		
+		std::vector<std::thread> readers;
+		readers.reserve(concurrency);
 		
-		// Perform concurrent deletions, insertions, overwrites, and reads.
 		for (int i = 0; i < concurrency; ++i) {
 			
-			std::exception_ptr exceptionPtr;
-			
-			threads.emplace_back(
-				std::thread([i, &threads, &hashmap, &exceptionPtr]() {
+			readers.emplace_back([&hashmap, &done]() {
+				
+				Triple triple {};
+				
+				while (!done.load(std::memory_order_relaxed)) {
 					
-					try {
-						for (int j = 0; j < iterations; ++j) {
-							
-							hashmap.Remove(j);
-							hashmap.Add(j, std::to_string(j));
-							hashmap.Assign(j, std::to_string(j));
-							
-							if (auto item = hashmap.Get(j)) {
-								assert(item.value() == std::to_string(j) && "Item value mismatch!");
-							}
-						}
+					if (hashmap.TryGetCopy(0, triple)) {
+						assert(triple.a == triple.b && triple.b == triple.c && "Torn read detected!");
 					}
-					catch (...) {
-						threads[i].second = std::current_exception();
-					}
-				}),
-				nullptr
-			);
+				}
+			});
 		}
 		
-		// Throw any exceptions:
-		for (auto& thread : threads) {
-			
-			thread.first.join();
-			
-			if (thread.second) {
-				std::rethrow_exception(thread.second);
-			}
+		for (size_t i = 1U; i <= iterations; ++i) {
+			hashmap.Assign(0, { i, i, i });
 		}
 		
-		// Assert the hashmap has the correct size.
-		assert(hashmap.size() == iterations && "Erroneous insertion detected!");
+		done.store(true, std::memory_order_relaxed);
 		
-		// Clear hashmap and assert it is empty.
-		hashmap.Clear();
-		assert(hashmap.empty() && "Clearing failed!");
+		for (auto& reader : readers) {
+			reader.join();
+		}
 		
 		std::cout << "Done.\n";
 	}
 	
+	// Test 7: The combining grind.
+	{
+		std::cout << "Test 7: The combining grind..." << std::flush;
+		
+		LouiEriksson::Hashmap<int, std::string, Combined> hashmap;
+		
+		const auto elapsed = Grind(hashmap);
+		
+		std::cout << "Done (" << elapsed << "ms).\n";
+	}
+	
 	std::cout << "All tests passed!" << std::endl;
 	
 	return 0;
-}
\ No newline at end of file
+}